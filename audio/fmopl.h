@@ -25,6 +25,7 @@
 
 #include "audio/audiostream.h"
 
+#include "common/array.h"
 #include "common/func.h"
 #include "common/ptr.h"
 #include "common/scummsys.h"
@@ -34,6 +35,7 @@ class SoundHandle;
 }
 
 namespace Common {
+class SeekableReadStream;
 class String;
 }
 
@@ -280,6 +282,28 @@ private:
 	Audio::SoundHandle *_handle;
 };
 
+/**
+ * Result of rendering a register capture with one of the OPL emulators.
+ */
+struct BenchmarkResult {
+	const char *name;	///< Name of the emulator, as accepted by --opl-driver
+	uint32 frames;		///< Number of sample frames rendered
+	uint32 millis;		///< Time it took to render them
+	uint32 checksum;	///< Checksum of the rendered samples, to compare builds against each other
+};
+
+/**
+ * Renders a stream of OPL register writes offline with every built-in
+ * emulator and measures how long each of them takes.
+ *
+ * @param capture	A DOSBox raw OPL capture (.dro, version 2) to play back,
+ *					or 0 to use a built-in test song
+ * @param rate		The sample rate to render at
+ * @param results	Receives one entry per emulator
+ * @return false if the capture could not be read, true otherwise
+ */
+bool benchmarkEmulators(Common::SeekableReadStream *capture, int rate, Common::Array<BenchmarkResult> &results);
+
 } // End of namespace OPL
 
 #endif
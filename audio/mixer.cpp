@@ -23,6 +23,7 @@
 #include "gui/EventRecorder.h"
 
 #include "common/util.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -269,6 +270,8 @@ void MixerImpl::playStream(
 int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
+	PROFILER_ZONE(kProfilerTrackAudio, "mixCallback");
+
 	Common::StackLock lock(_mutex);
 
 	int16 *buf = (int16 *)samples;
@@ -40,6 +40,8 @@
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/osd_message_queue.h"
+#include "common/profiler.h"
+#include "common/timer.h"
 
 #include "graphics/fontman.h"
 #include "graphics/surface.h"
@@ -113,6 +115,41 @@ private:
 
 	int _outputRate;
 
+	enum {
+		kAheadBufferSize = 8192,	///< Size of the render ahead ring, in stereo frames
+		kAheadChunkSize = 256,		///< Frames rendered ahead at once, before the mixer gets a chance to lock
+		kAheadInterval = 10000,		///< Render ahead timer interval, in microseconds
+		kStatsInterval = 5			///< Render timing report interval, in seconds of audio
+	};
+
+	// Render ahead, see renderAhead()
+	bool _renderAhead;
+	Common::Mutex _aheadMutex;
+	int16 *_aheadBuffer;
+	int _aheadRead;		///< Ring position of the next frame to play
+	int _aheadCount;	///< Number of frames rendered ahead
+	int _aheadTarget;	///< Number of frames to keep rendered ahead, one mixer buffer
+
+	// Render timing, see updateRenderStats()
+	uint64 _renderMicros;
+	uint32 _renderMaxMicros;
+	uint32 _renderFrames;
+	uint32 _renderCalls;
+	uint32 _underruns;
+
+	void updateRenderStats(uint32 micros, int len);
+	void renderSamples(int16 *data, int len);
+
+	/**
+	 * Timer callback, which renders on the timer thread until one mixer
+	 * buffer worth of samples is waiting. The mixer thread then only has
+	 * to copy them, so heavy rendering doesn't eat into its deadline.
+	 * Only the synth runs here: the music timer callbacks are still
+	 * dispatched by readBuffer() on the mixer thread.
+	 */
+	static void renderAheadProc(void *refCon);
+	void renderAhead();
+
 protected:
 	void generateSamples(int16 *buf, int len);
 
@@ -131,6 +168,7 @@ public:
 	MidiChannel *getPercussionChannel();
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples);
 	bool isStereo() const { return true; }
 	int getRate() const { return _outputRate; }
 };
@@ -150,6 +188,11 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_renderAhead = false;
+	_aheadBuffer = nullptr;
+	_aheadRead = _aheadCount = _aheadTarget = 0;
+	_renderMicros = 0;
+	_renderMaxMicros = _renderFrames = _renderCalls = _underruns = 0;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -221,6 +264,13 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	_renderAhead = ConfMan.getBool("mt32_render_ahead");
+	if (_renderAhead) {
+		_aheadBuffer = new int16[kAheadBufferSize * 2];
+		_aheadRead = _aheadCount = _aheadTarget = 0;
+		g_system->getTimerManager()->installTimerProc(&renderAheadProc, kAheadInterval, this, "MT32RenderAhead");
+	}
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -271,6 +321,13 @@ void MidiDriver_MT32::close() {
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
 
+	if (_renderAhead) {
+		g_system->getTimerManager()->removeTimerProc(&renderAheadProc);
+		delete[] _aheadBuffer;
+		_aheadBuffer = nullptr;
+		_renderAhead = false;
+	}
+
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
 	_service.freeContext();
@@ -281,8 +338,92 @@ void MidiDriver_MT32::close() {
 }
 
 void MidiDriver_MT32::generateSamples(int16 *data, int len) {
+	if (!_renderAhead) {
+		renderSamples(data, len);
+		return;
+	}
+
+	Common::StackLock lock(_aheadMutex);
+
+	int copied = 0;
+	while (copied < len && _aheadCount > 0) {
+		const int chunk = MIN(len - copied, MIN(_aheadCount, kAheadBufferSize - _aheadRead));
+		memcpy(data + copied * 2, _aheadBuffer + _aheadRead * 2, chunk * 2 * sizeof(int16));
+		copied += chunk;
+		_aheadRead = (_aheadRead + chunk) % kAheadBufferSize;
+		_aheadCount -= chunk;
+	}
+
+	if (copied < len) {
+		// The timer thread fell behind, so render the rest right away
+		renderSamples(data + copied * 2, len - copied);
+		_underruns++;
+	}
+}
+
+void MidiDriver_MT32::renderSamples(int16 *data, int len) {
 	Common::StackLock lock(_mutex);
+	const uint64 start = g_system->getMicros();
 	_service.renderBit16s(data, len);
+	updateRenderStats((uint32)(g_system->getMicros() - start), len);
+}
+
+void MidiDriver_MT32::updateRenderStats(uint32 micros, int len) {
+	_renderMicros += micros;
+	_renderMaxMicros = MAX(_renderMaxMicros, micros);
+	_renderFrames += len;
+	_renderCalls++;
+
+	if (_renderFrames < (uint32)_outputRate * kStatsInterval)
+		return;
+
+	const double realMicros = _renderFrames * 1000000.0 / _outputRate;
+	debug(2, "MT32Emu: Rendering took %.1f%% of real time, %u calls, slowest %u us, %u late buffers",
+	      _renderMicros * 100.0 / realMicros, _renderCalls, _renderMaxMicros, _underruns);
+
+	_renderMicros = 0;
+	_renderMaxMicros = _renderFrames = _renderCalls = _underruns = 0;
+}
+
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	PROFILER_ZONE(kProfilerTrackAudio, "MT-32");
+
+	if (!_renderAhead)
+		return MidiDriver_Emulated::readBuffer(data, numSamples);
+
+	{
+		// Keep as much rendered ahead as the mixer asks for at once
+		Common::StackLock lock(_aheadMutex);
+		_aheadTarget = MIN<int>(MAX(_aheadTarget, numSamples / 2), kAheadBufferSize);
+	}
+
+	// The music timer callbacks run in here, outside of _aheadMutex. Only
+	// the generateSamples() calls in between take the rendered samples.
+	return MidiDriver_Emulated::readBuffer(data, numSamples);
+}
+
+void MidiDriver_MT32::renderAheadProc(void *refCon) {
+	static_cast<MidiDriver_MT32 *>(refCon)->renderAhead();
+}
+
+void MidiDriver_MT32::renderAhead() {
+	PROFILER_ZONE(kProfilerTrackTimer, "MT-32 render ahead");
+
+	// Rendering happens in small chunks and gives up the lock in between,
+	// so that the mixer thread never has to wait for more than one chunk.
+	// Everything is still rendered in stream order: when the mixer thread
+	// runs out, it renders the next samples itself while holding the lock.
+	// No callbacks run while the lock is held, see readBuffer().
+	for (;;) {
+		Common::StackLock lock(_aheadMutex);
+		if (_aheadCount >= _aheadTarget)
+			break;
+
+		const int writePos = (_aheadRead + _aheadCount) % kAheadBufferSize;
+		const int chunk = MIN<int>(MIN(_aheadTarget - _aheadCount, kAheadBufferSize - writePos), kAheadChunkSize);
+		renderSamples(_aheadBuffer + writePos * 2, chunk);
+		_aheadCount += chunk;
+	}
 }
 
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
@@ -0,0 +1,341 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/fmopl.h"
+
+#include "audio/softsynth/opl/dbopl.h"
+#include "audio/softsynth/opl/mame.h"
+#include "audio/softsynth/opl/nuked.h"
+
+#include "common/stream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+namespace OPL {
+
+namespace {
+
+struct RegisterWrite {
+	uint32 time;	///< Time of the write, in milliseconds from the start
+	uint16 reg;
+	uint8 val;
+};
+
+typedef Common::Array<RegisterWrite> RegisterWrites;
+
+enum {
+	kBufferFrames = 512,
+	kSongSteps = 1800,	///< Length of the built-in song, three minutes
+	kSongStepTime = 100	///< Time between two notes of the built-in song, in milliseconds
+};
+
+/**
+ * Loads a version 2 DOSBox raw OPL capture.
+ */
+bool loadCapture(Common::SeekableReadStream &stream, RegisterWrites &writes, bool &opl3) {
+	char id[8];
+	if (stream.read(id, 8) != 8 || memcmp(id, "DBRAWOPL", 8)) {
+		warning("OPL benchmark: Not a DOSBox raw OPL capture");
+		return false;
+	}
+
+	const uint16 versionMajor = stream.readUint16LE();
+	stream.readUint16LE(); // minor version
+	if (versionMajor != 2) {
+		warning("OPL benchmark: Unsupported capture version %d", versionMajor);
+		return false;
+	}
+
+	const uint32 pairs = stream.readUint32LE();
+	stream.readUint32LE(); // length in milliseconds
+	const byte hardware = stream.readByte();
+	const byte format = stream.readByte();
+	const byte compression = stream.readByte();
+	const byte shortDelayCode = stream.readByte();
+	const byte longDelayCode = stream.readByte();
+	const byte codemapLength = stream.readByte();
+
+	if (format != 0 || compression != 0 || codemapLength > 128) {
+		warning("OPL benchmark: Unsupported capture format");
+		return false;
+	}
+
+	byte codemap[128];
+	stream.read(codemap, codemapLength);
+
+	// Both dual OPL2 and OPL3 captures use the second register bank
+	opl3 = (hardware != 0);
+
+	uint32 time = 0;
+	for (uint32 i = 0; i < pairs && !stream.eos(); ++i) {
+		const byte code = stream.readByte();
+		const byte val = stream.readByte();
+
+		if (code == shortDelayCode) {
+			time += val + 1;
+		} else if (code == longDelayCode) {
+			time += (val + 1) << 8;
+		} else if ((code & 0x7F) < codemapLength) {
+			RegisterWrite write;
+			write.time = time;
+			write.reg = codemap[code & 0x7F] | ((code & 0x80) ? 0x100 : 0);
+			write.val = val;
+			writes.push_back(write);
+		}
+	}
+
+	if (stream.err()) {
+		warning("OPL benchmark: Could not read the capture");
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Creates a song using all nine melodic channels, with vibrato, tremolo,
+ * feedback and every envelope stage in use.
+ */
+void createSong(RegisterWrites &writes) {
+	static const uint8 operatorOffsets[9] = { 0, 1, 2, 8, 9, 10, 16, 17, 18 };
+	static const uint16 noteFrequencies[12] = {
+		0x157, 0x16B, 0x181, 0x198, 0x1B0, 0x1CA, 0x1E5, 0x202, 0x220, 0x241, 0x263, 0x287
+	};
+
+	const uint8 setup[][2] = {
+		{ 0x01, 0x20 },	// Enable waveform selection
+		{ 0xBD, 0xC0 }	// Deep tremolo and vibrato
+	};
+
+	RegisterWrite write;
+	write.time = 0;
+
+	for (uint i = 0; i < ARRAYSIZE(setup); ++i) {
+		write.reg = setup[i][0];
+		write.val = setup[i][1];
+		writes.push_back(write);
+	}
+
+	for (uint c = 0; c < 9; ++c) {
+		const uint8 mod = operatorOffsets[c];
+		const uint8 car = mod + 3;
+		const uint8 instrument[][2] = {
+			{ (uint8)(0x20 + mod), (uint8)(0x01 | ((c & 1) ? 0xC0 : 0x00)) },
+			{ (uint8)(0x20 + car), (uint8)(0x01 | ((c & 2) ? 0x20 : 0x00)) },
+			{ (uint8)(0x40 + mod), (uint8)(0x10 + c) },
+			{ (uint8)(0x40 + car), 0x00 },
+			{ (uint8)(0x60 + mod), 0xF2 },
+			{ (uint8)(0x60 + car), (uint8)(0xA3 + c) },
+			{ (uint8)(0x80 + mod), 0x54 },
+			{ (uint8)(0x80 + car), (uint8)(0x35 + c) },
+			{ (uint8)(0xE0 + mod), (uint8)(c & 3) },
+			{ (uint8)(0xE0 + car), 0x00 },
+			{ (uint8)(0xC0 + c), (uint8)(((c % 7) << 1) | (c == 4 ? 1 : 0)) }
+		};
+
+		for (uint i = 0; i < ARRAYSIZE(instrument); ++i) {
+			write.reg = instrument[i][0];
+			write.val = instrument[i][1];
+			writes.push_back(write);
+		}
+	}
+
+	uint32 seed = 1;
+	for (uint step = 0; step < kSongSteps; ++step) {
+		write.time = step * kSongStepTime;
+
+		// Release an older note so that the release stage gets used as well
+		write.reg = 0xB0 + (step + 4) % 9;
+		write.val = 0;
+		writes.push_back(write);
+
+		seed = seed * 1103515245 + 12345;
+		const uint c = step % 9;
+		const uint16 frequency = noteFrequencies[(seed >> 16) % 12];
+		const uint8 block = 2 + (seed >> 24) % 4;
+
+		write.reg = 0xB0 + c;
+		write.val = 0;
+		writes.push_back(write);
+		write.reg = 0xA0 + c;
+		write.val = frequency & 0xFF;
+		writes.push_back(write);
+		write.reg = 0xB0 + c;
+		write.val = 0x20 | (block << 2) | (frequency >> 8);
+		writes.push_back(write);
+	}
+
+	// Let the last notes ring out
+	write.time = kSongSteps * kSongStepTime + 1000;
+	write.reg = 0xBD;
+	write.val = 0xC0;
+	writes.push_back(write);
+}
+
+/**
+ * The emulator cores are driven directly, so that the benchmark neither
+ * needs a mixer nor measures the resampling done by it.
+ */
+class Core {
+public:
+	virtual ~Core() {}
+
+	virtual void writeReg(int reg, int val) = 0;
+
+	/**
+	 * Render the given number of sample frames.
+	 * @return the number of samples written to the buffer
+	 */
+	virtual int render(int16 *buffer, int frames) = 0;
+};
+
+#ifndef DISABLE_DOSBOX_OPL
+class DOSBoxCore : public Core {
+public:
+	DOSBoxCore(int rate, bool opl3) {
+		DOSBox::DBOPL::InitTables();
+		_chip.Setup(rate);
+		if (opl3)
+			_chip.WriteReg(0x105, 1);
+	}
+
+	void writeReg(int reg, int val) {
+		_chip.WriteReg(reg, val);
+	}
+
+	int render(int16 *buffer, int frames) {
+		const int samples = _chip.opl3Active ? frames * 2 : frames;
+
+		if (_chip.opl3Active)
+			_chip.GenerateBlock3(frames, _temp);
+		else
+			_chip.GenerateBlock2(frames, _temp);
+
+		for (int i = 0; i < samples; ++i)
+			buffer[i] = _temp[i];
+
+		return samples;
+	}
+
+private:
+	DOSBox::DBOPL::Chip _chip;
+	int32 _temp[kBufferFrames * 2];
+};
+#endif
+
+class MAMECore : public Core {
+public:
+	MAMECore(int rate) : _opl(MAME::makeAdLibOPL(rate)) {}
+	~MAMECore() { MAME::OPLDestroy(_opl); }
+
+	void writeReg(int reg, int val) {
+		MAME::OPLWriteReg(_opl, reg, val);
+	}
+
+	int render(int16 *buffer, int frames) {
+		MAME::YM3812UpdateOne(_opl, buffer, frames);
+		return frames;
+	}
+
+private:
+	MAME::FM_OPL *_opl;
+};
+
+#ifndef DISABLE_NUKED_OPL
+class NukedCore : public Core {
+public:
+	NukedCore(int rate) {
+		NUKED::OPL3_Reset(&_chip, rate);
+	}
+
+	void writeReg(int reg, int val) {
+		NUKED::OPL3_WriteRegBuffered(&_chip, reg, val);
+	}
+
+	int render(int16 *buffer, int frames) {
+		NUKED::OPL3_GenerateStream(&_chip, buffer, frames);
+		return frames * 2;
+	}
+
+private:
+	NUKED::opl3_chip _chip;
+};
+#endif
+
+void runCore(const char *name, Core *core, const RegisterWrites &writes, int rate, Common::Array<BenchmarkResult> &results) {
+	int16 buffer[kBufferFrames * 2];
+	uint32 frame = 0;
+	uint32 checksum = 0;
+
+	const uint32 start = g_system->getMillis();
+
+	for (uint i = 0; i < writes.size(); ++i) {
+		const uint32 target = (uint64)writes[i].time * rate / 1000;
+
+		while (frame < target) {
+			const int frames = MIN<uint32>(target - frame, kBufferFrames);
+			const int samples = core->render(buffer, frames);
+			for (int j = 0; j < samples; ++j)
+				checksum = checksum * 31 + (uint16)buffer[j];
+			frame += frames;
+		}
+
+		core->writeReg(writes[i].reg, writes[i].val);
+	}
+
+	BenchmarkResult result;
+	result.name = name;
+	result.frames = frame;
+	result.millis = g_system->getMillis() - start;
+	result.checksum = checksum;
+	results.push_back(result);
+
+	delete core;
+}
+
+} // End of anonymous namespace
+
+bool benchmarkEmulators(Common::SeekableReadStream *capture, int rate, Common::Array<BenchmarkResult> &results) {
+	RegisterWrites writes;
+	bool opl3 = false;
+
+	if (capture) {
+		if (!loadCapture(*capture, writes, opl3))
+			return false;
+	} else {
+		createSong(writes);
+	}
+
+#ifndef DISABLE_DOSBOX_OPL
+	runCore("db", new DOSBoxCore(rate, opl3), writes, rate, results);
+#endif
+	// The MAME emulator only supports a single OPL2
+	if (!opl3)
+		runCore("mame", new MAMECore(rate), writes, rate, results);
+#ifndef DISABLE_NUKED_OPL
+	runCore("nuked", new NukedCore(rate), writes, rate, results);
+#endif
+
+	return true;
+}
+
+} // End of namespace OPL
@@ -25,6 +25,7 @@
 #include "backends/platform/sdl/sdl.h"
 #include "backends/events/sdl/sdl-events.h"
 #include "common/config-manager.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 #include "graphics/scaler/aspect.h"
 #ifdef USE_OSD
@@ -324,9 +325,31 @@ bool SdlGraphicsManager::notifyEvent(const Common::Event &event) {
 			return true;
 		}
 
+#ifdef ENABLE_PROFILER
+		if (event.kbd.hasFlags(Common::KBD_CTRL | Common::KBD_ALT)) {
+			// Ctrl-Alt-P: Toggle the frame timing overlay
+			if (event.kbd.keycode == Common::KEYCODE_p) {
+				g_profiler.setOverlayEnabled(!g_profiler.isOverlayEnabled());
+				return true;
+			}
+
+			// Ctrl-Alt-T: Dump the recorded profiler samples
+			if (event.kbd.keycode == Common::KEYCODE_t) {
+				g_profiler.dumpChromeTrace("scummvm-trace.json");
+				return true;
+			}
+		}
+#endif
+
 		break;
 
 	case Common::EVENT_KEYUP:
+#ifdef ENABLE_PROFILER
+		if (event.kbd.hasFlags(Common::KBD_CTRL | Common::KBD_ALT) &&
+			(event.kbd.keycode == Common::KEYCODE_p || event.kbd.keycode == Common::KEYCODE_t))
+			return true;
+#endif
+
 		if (event.kbd.hasFlags(Common::KBD_ALT)) {
 			return    event.kbd.keycode == Common::KEYCODE_RETURN
 			       || event.kbd.keycode == Common::KEYCODE_KP_ENTER
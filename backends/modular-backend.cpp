@@ -29,6 +29,7 @@
 #include "gui/EventRecorder.h"
 
 #include "audio/mixer.h"
+#include "common/profiler.h"
 #include "graphics/pixelformat.h"
 
 ModularBackend::ModularBackend()
@@ -174,6 +175,11 @@ void ModularBackend::fillScreen(uint32 col) {
 }
 
 void ModularBackend::updateScreen() {
+#ifdef ENABLE_PROFILER
+	g_profiler.endFrame();
+#endif
+	PROFILER_ZONE(kProfilerTrackMain, "updateScreen");
+
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.preDrawOverlayGui();
 #endif
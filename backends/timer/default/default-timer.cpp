@@ -23,6 +23,7 @@
 #include "common/scummsys.h"
 #include "backends/timer/default/default-timer.h"
 #include "common/util.h"
+#include "common/profiler.h"
 #include "common/system.h"
 
 struct TimerSlot {
@@ -80,6 +81,8 @@ DefaultTimerManager::~DefaultTimerManager() {
 }
 
 void DefaultTimerManager::handler() {
+	PROFILER_ZONE(kProfilerTrackTimer, "timerHandler");
+
 	Common::StackLock lock(_mutex);
 
 	uint32 curTime = g_system->getMillis(true);
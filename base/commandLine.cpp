@@ -36,11 +36,13 @@
 #include "common/fs.h"
 #include "common/rendermode.h"
 #include "common/stack.h"
+#include "common/stream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
 #include "gui/ThemeEngine.h"
 
+#include "audio/fmopl.h"
 #include "audio/musicplugin.h"
 
 #define DETECTOR_TESTING_HACK
@@ -101,6 +103,8 @@ static const char HELP_STRING[] =
 	"  --list-themes            Display list of all usable GUI themes\n"
 	"  -e, --music-driver=MODE  Select music driver (see README for details)\n"
 	"  --list-audio-devices     List all available audio devices\n"
+	"  --benchmark-opl[=FILE]   Render a DOSBox OPL capture (.dro) or a built-in test\n"
+	"                           song with every AdLib emulator and display their speed\n"
 	"  -q, --language=LANG      Select language (en,de,fr,it,pt,es,jp,zh,kr,se,gb,\n"
 	"                           hb,ru,cz)\n"
 	"  -m, --music-volume=NUM   Set the music volume, 0-255 (default: 192)\n"
@@ -230,6 +234,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("native_mt32", false);
 	ConfMan.registerDefault("enable_gs", false);
 	ConfMan.registerDefault("midi_gain", 100);
+	ConfMan.registerDefault("mt32_render_ahead", false);
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
@@ -486,6 +491,11 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_COMMAND("list-audio-devices")
 			END_COMMAND
 
+			DO_LONG_OPTION_OPT("benchmark-opl", "")
+				ensureFirstCommand(command, "benchmark-opl");
+				command = "benchmark-opl";
+			END_OPTION
+
 			DO_LONG_OPTION_INT("output-rate")
 			END_OPTION
 
@@ -859,6 +869,38 @@ static void listAudioDevices() {
 	}
 }
 
+/** Renders an OPL register capture with all AdLib emulators and displays how fast they are */
+static Common::Error benchmarkOPL(const Common::String &filename, const Common::String &outputRate) {
+	Common::ScopedPtr<Common::SeekableReadStream> capture;
+	if (!filename.empty()) {
+		capture.reset(Common::FSNode(filename).createReadStream());
+		if (!capture) {
+			printf("Could not open '%s'.\n", filename.c_str());
+			return Common::kReadingFailed;
+		}
+	}
+
+	int rate = outputRate.empty() ? 44100 : atoi(outputRate.c_str());
+	if (rate <= 0)
+		rate = 44100;
+
+	Common::Array<OPL::BenchmarkResult> results;
+	if (!OPL::benchmarkEmulators(capture.get(), rate, results))
+		return Common::kReadingFailed;
+
+	printf("Emulator  Duration  Render time  Samples/s   Realtime  Checksum\n");
+	printf("--------- --------- ------------ ----------- --------- --------\n");
+
+	for (uint i = 0; i < results.size(); ++i) {
+		const OPL::BenchmarkResult &r = results[i];
+		const uint32 millis = MAX<uint32>(r.millis, 1);
+		printf("%-9s %7.1f s %9u ms %11u %8.1fx %08x\n", r.name, r.frames / (double)rate, r.millis,
+		       (uint)((uint64)r.frames * 1000 / millis), r.frames * 1000.0 / rate / millis, r.checksum);
+	}
+
+	return Common::kNoError;
+}
+
 /** Display all games in the given directory, or current directory if empty */
 static DetectedGames getGameList(const Common::FSNode &dir) {
 	Common::FSList files;
@@ -1195,6 +1237,9 @@ bool processSettings(Common::String &command, Common::StringMap &settings, Commo
 	} else if (command == "list-audio-devices") {
 		listAudioDevices();
 		return true;
+	} else if (command == "benchmark-opl") {
+		err = benchmarkOPL(settings["benchmark-opl"], settings["output-rate"]);
+		return true;
 	} else if (command == "version") {
 		printf("%s\n", gScummVMFullVersion);
 		printf("Features compiled in: %s\n", gScummVMFeatures);
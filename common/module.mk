@@ -57,6 +57,11 @@ MODULE_OBJS += \
 	recorderfile.o
 endif
 
+ifdef ENABLE_PROFILER
+MODULE_OBJS += \
+	profiler.o
+endif
+
 ifdef USE_UPDATES
 MODULE_OBJS += \
 	updates.o
@@ -0,0 +1,198 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/profiler.h"
+
+#ifdef ENABLE_PROFILER
+
+#include "common/debug.h"
+#include "common/file.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(Profiler);
+
+static const char *const s_trackNames[kProfilerTrackCount] = {
+	"main",
+	"audio",
+	"timer"
+};
+
+Profiler::Profiler() : _lastFrameTime(0), _lastOverlayTime(0), _overlayEnabled(false) {
+	for (int i = 0; i < kProfilerTrackCount; ++i)
+		_tracks[i].written = 0;
+}
+
+void Profiler::addSample(ProfilerTrack track, const char *name, uint64 start, uint64 end) {
+	Track &t = _tracks[track];
+	Sample &sample = t.samples[t.written & (kSamplesPerTrack - 1)];
+	sample.name = name;
+	sample.start = start;
+	sample.duration = (uint32)(end - start);
+	// Readers on other threads may see a half written sample in the slot
+	// currently being overwritten. That is acceptable for diagnostics and
+	// keeps recording free of locks.
+	t.written = t.written + 1;
+}
+
+void Profiler::endFrame() {
+	const uint64 now = g_system->getMicros();
+
+	if (_lastFrameTime)
+		addSample(kProfilerTrackMain, "frame", _lastFrameTime, now);
+	_lastFrameTime = now;
+
+	if (!_overlayEnabled)
+		return;
+
+	if (now - _lastOverlayTime >= kOverlayInterval) {
+		String summary = buildOverlaySummary(_lastOverlayTime, now);
+		_lastOverlayTime = now;
+		if (!summary.empty())
+			g_system->displayMessageOnOSD(summary.c_str());
+	}
+}
+
+void Profiler::setOverlayEnabled(bool enable) {
+	_overlayEnabled = enable;
+	_lastOverlayTime = g_system->getMicros();
+}
+
+String Profiler::buildOverlaySummary(uint64 since, uint64 now) const {
+	struct ZoneStats {
+		const char *name;
+		uint64 total;
+		uint32 count;
+	};
+
+	ZoneStats zones[kMaxOverlayZones];
+	int zoneCount = 0;
+	uint64 frameTotal = 0;
+	uint32 frameMax = 0;
+	uint32 frames = 0;
+
+	for (int i = 0; i < kProfilerTrackCount; ++i) {
+		const Track &t = _tracks[i];
+		const uint32 written = t.written;
+		const uint32 count = MIN<uint32>(written, kSamplesPerTrack);
+
+		for (uint32 j = written - count; j != written; ++j) {
+			const Sample &sample = t.samples[j & (kSamplesPerTrack - 1)];
+			if (sample.start < since || sample.start > now || !sample.name)
+				continue;
+
+			if (i == kProfilerTrackMain && !strcmp(sample.name, "frame")) {
+				frameTotal += sample.duration;
+				frameMax = MAX(frameMax, sample.duration);
+				++frames;
+				continue;
+			}
+
+			int k;
+			for (k = 0; k < zoneCount; ++k) {
+				if (!strcmp(zones[k].name, sample.name))
+					break;
+			}
+
+			if (k == zoneCount) {
+				if (zoneCount == kMaxOverlayZones)
+					continue;
+				zones[k].name = sample.name;
+				zones[k].total = 0;
+				zones[k].count = 0;
+				++zoneCount;
+			}
+
+			zones[k].total += sample.duration;
+			zones[k].count++;
+		}
+	}
+
+	if (!frames)
+		return String();
+
+	String summary = String::format("%u fps, frame %.1f ms avg / %.1f ms max",
+	                                (uint)((uint64)frames * 1000000 / (now - since)),
+	                                frameTotal / (frames * 1000.0), frameMax / 1000.0);
+
+	for (int k = 0; k < zoneCount; ++k) {
+		summary += String::format("\n%s: %.2f ms/frame (%u calls)",
+		                          zones[k].name, zones[k].total / (frames * 1000.0), zones[k].count);
+	}
+
+	return summary;
+}
+
+bool Profiler::dumpChromeTrace(const String &filename) const {
+	DumpFile out;
+	if (!out.open(filename)) {
+		warning("Profiler: Could not open '%s' for writing", filename.c_str());
+		return false;
+	}
+
+	out.writeString("{\"traceEvents\":[\n");
+
+	bool first = true;
+	for (int i = 0; i < kProfilerTrackCount; ++i) {
+		out.writeString(String::format("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+		                               first ? "" : ",\n", i, s_trackNames[i]));
+		first = false;
+
+		const Track &t = _tracks[i];
+		const uint32 written = t.written;
+		const uint32 count = MIN<uint32>(written, kSamplesPerTrack);
+
+		for (uint32 j = written - count; j != written; ++j) {
+			const Sample &sample = t.samples[j & (kSamplesPerTrack - 1)];
+			if (!sample.name)
+				continue;
+
+			out.writeString(String::format(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.0f,\"dur\":%u,\"pid\":1,\"tid\":%d}",
+			                               sample.name, s_trackNames[i], (double)sample.start, sample.duration, i));
+		}
+	}
+
+	out.writeString("\n]}\n");
+	out.finalize();
+
+	if (out.err()) {
+		warning("Profiler: Could not write '%s'", filename.c_str());
+		return false;
+	}
+
+	debug("Profiler: Wrote trace to '%s'", filename.c_str());
+	return true;
+}
+
+ProfilerZone::ProfilerZone(ProfilerTrack track, const char *name)
+	: _track(track), _name(name), _start(g_system->getMicros()) {
+}
+
+ProfilerZone::~ProfilerZone() {
+	g_profiler.addSample(_track, _name, _start, g_system->getMicros());
+}
+
+} // End of namespace Common
+
+#endif // ENABLE_PROFILER
@@ -0,0 +1,152 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+
+#ifdef ENABLE_PROFILER
+
+#include "common/singleton.h"
+#include "common/str.h"
+
+namespace Common {
+
+/**
+ * The thread a profiler zone is recorded on. Every track owns its own
+ * sample ring, which is only ever written by the thread it is named after,
+ * so recording a zone does not need any locking.
+ */
+enum ProfilerTrack {
+	kProfilerTrackMain = 0,  ///< Engine / GUI thread
+	kProfilerTrackAudio,     ///< Mixer callback
+	kProfilerTrackTimer,     ///< Timer manager callbacks
+
+	kProfilerTrackCount
+};
+
+/**
+ * Lightweight frame profiler.
+ *
+ * Code marks the interesting parts of the hot paths with PROFILER_ZONE().
+ * The backend calls endFrame() once per presented frame, which records the
+ * frame time and, when enabled, periodically shows a summary of the last
+ * second on the OSD. The full contents of the sample rings can be written
+ * out in the Chrome trace event format (chrome://tracing, Perfetto).
+ *
+ * The profiler only exists when ScummVM was configured with
+ * --enable-profiler; otherwise PROFILER_ZONE() expands to nothing.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	enum {
+		kSamplesPerTrack = 8192,     ///< Ring size of every track (power of two)
+		kOverlayInterval = 1000000,  ///< OSD summary refresh interval (in microseconds)
+		kMaxOverlayZones = 6         ///< Number of zones listed in the OSD summary
+	};
+
+	struct Sample {
+		const char *name;  ///< Zone name, must be a string literal
+		uint64 start;      ///< Start time (in microseconds)
+		uint32 duration;   ///< Duration (in microseconds)
+	};
+
+	Profiler();
+
+	/**
+	 * Record a finished zone.
+	 *
+	 * Must only be called from the thread the track belongs to.
+	 */
+	void addSample(ProfilerTrack track, const char *name, uint64 start, uint64 end);
+
+	/**
+	 * Mark the end of a frame. Must be called from the main thread.
+	 */
+	void endFrame();
+
+	/** Toggle the OSD frame timing summary. */
+	void setOverlayEnabled(bool enable);
+	bool isOverlayEnabled() const { return _overlayEnabled; }
+
+	/**
+	 * Write the recorded samples of all tracks as a Chrome trace JSON file.
+	 *
+	 * @param filename  the file to create, relative to the current directory
+	 * @return true on success, false otherwise
+	 */
+	bool dumpChromeTrace(const String &filename) const;
+
+private:
+	struct Track {
+		Sample samples[kSamplesPerTrack];
+		/** Total number of samples ever recorded, only written by the owner. */
+		volatile uint32 written;
+	};
+
+	String buildOverlaySummary(uint64 since, uint64 now) const;
+
+	Track _tracks[kProfilerTrackCount];
+
+	uint64 _lastFrameTime;
+	uint64 _lastOverlayTime;
+	bool _overlayEnabled;
+};
+
+/**
+ * Records the lifetime of the enclosing scope as a profiler zone.
+ * Use the PROFILER_ZONE() macro instead of using this directly.
+ */
+class ProfilerZone {
+public:
+	ProfilerZone(ProfilerTrack track, const char *name);
+	~ProfilerZone();
+
+private:
+	ProfilerTrack _track;
+	const char *_name;
+	uint64 _start;
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the profiler. */
+#define g_profiler (Common::Profiler::instance())
+
+#define PROFILER_ZONE_NAME_(line) profilerZone##line
+#define PROFILER_ZONE_NAME(line) PROFILER_ZONE_NAME_(line)
+
+/**
+ * Profile the rest of the enclosing scope as zone @p name on @p track.
+ * The name must be a string literal.
+ */
+#define PROFILER_ZONE(track, name) \
+	Common::ProfilerZone PROFILER_ZONE_NAME(__LINE__)(Common::track, name)
+
+#else
+
+#define PROFILER_ZONE(track, name) do {} while (0)
+
+#endif // ENABLE_PROFILER
+
+#endif
@@ -25,6 +25,7 @@
 #include "common/system.h"
 #include "common/events.h"
 #include "common/fs.h"
+#include "common/profiler.h"
 #include "common/savefile.h"
 #include "common/str.h"
 #include "common/taskbar.h"
@@ -54,6 +55,12 @@ OSystem::OSystem() {
 #endif
 	_fsFactory = nullptr;
 	_backendInitialized = false;
+
+#ifdef ENABLE_PROFILER
+	// Create the profiler before any backend threads can record samples,
+	// Common::Singleton creation is not thread safe.
+	Common::Profiler::instance();
+#endif
 }
 
 OSystem::~OSystem() {
@@ -86,6 +93,10 @@ OSystem::~OSystem() {
 
 	delete _fsFactory;
 	_fsFactory = nullptr;
+
+#ifdef ENABLE_PROFILER
+	Common::Profiler::destroy();
+#endif
 }
 
 void OSystem::initBackend() {
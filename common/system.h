@@ -1087,6 +1087,15 @@ public:
 	*/
 	virtual uint32 getMillis(bool skipRecord = false) = 0;
 
+	/** Get the number of microseconds since the program was started.
+
+	    This is meant for measuring short intervals, e.g. by the profiler,
+	    and is never recorded by the event recorder. Backends with a high
+	    resolution clock should override the default implementation, which
+	    is based on getMillis().
+	*/
+	virtual uint64 getMicros() { return (uint64)getMillis(true) * 1000; }
+
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
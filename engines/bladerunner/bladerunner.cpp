@@ -98,6 +98,7 @@ BladeRunnerEngine::BladeRunnerEngine(OSystem *syst, const ADGameDescription *des
 	  _rnd("bladerunner") {
 
 	DebugMan.addDebugChannel(kDebugScript, "Script", "Debug the scripts");
+	DebugMan.addDebugChannel(kDebugVideo, "Video", "Debug the VQA decoding");
 
 	_windowIsActive = true;
 	_gameIsRunning  = true;
@@ -53,7 +53,8 @@ struct ADGameDescription;
 namespace BladeRunner {
 
 enum DebugLevels {
-	kDebugScript = 1 << 0
+	kDebugScript = 1 << 0,
+	kDebugVideo  = 1 << 1
 };
 
 class Actor;
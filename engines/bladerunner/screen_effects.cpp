@@ -182,4 +182,14 @@ void ScreenEffects::getColor(Color256 *outColor, uint16 x, uint16 y, uint16 z) c
 	*outColor = color;
 }
 
+bool ScreenEffects::isAffectingLine(uint16 y) const {
+	for (Common::Array<const Entry>::iterator entry = _entries.begin(); entry != _entries.end(); ++entry) {
+		uint16 y1 = (y / 2) - entry->y;
+		if (y1 < entry->height) {
+			return true;
+		}
+	}
+	return false;
+}
+
 } // End of namespace BladeRunner
@@ -65,6 +65,7 @@ public:
 
 	void readVqa(Common::SeekableReadStream *stream);
 	void getColor(Color256 *outColor, uint16 x, uint16 y, uint16 z) const;
+	bool isAffectingLine(uint16 y) const;
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	void toggleEntry(int effectId, bool skip); // added method to allow skipping specified effects
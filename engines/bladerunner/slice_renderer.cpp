@@ -50,6 +50,9 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_view          = nullptr;
 	_lights        = nullptr;
 	_setEffects    = nullptr;
+
+	memset(_litColorStamp, 0, sizeof(_litColorStamp));
+	_currentLitColorStamp = 0;
 	_sliceFramePtr = nullptr;
 
 	_frameBottomZ      = 0.0f;
@@ -544,6 +547,18 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 
 	SliceAnimations::Palette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	// Lights and set effects are constant for the whole scanline, only the
+	// screen effects depend on the position of the pixel
+	bool lineHasScreenEffects = false;
+	if (advanced) {
+		lineHasScreenEffects = _screenEffects->isAffectingLine(y);
+
+		if (++_currentLitColorStamp == 0) {
+			memset(_litColorStamp, 0, sizeof(_litColorStamp));
+			_currentLitColorStamp = 1;
+		}
+	}
+
 	byte *p = (byte *)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -571,23 +586,39 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 				int vertexZ = (_m21lookup[p[0]] + _m22lookup[p[1]] + _m23) / 64;
 
 				if (vertexZ >= 0 && vertexZ < 65536) {
-					int color555 = palette.color555[p[2]];
+					uint8 colorIndex = p[2];
+					uint16 color555 = palette.color555[colorIndex];
 					if (advanced) {
-						Color256 aescColor = { 0, 0, 0 };
-						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
-
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
+						if (_litColorStamp[colorIndex] != _currentLitColorStamp) {
+							const Color256 &color = palette.color[colorIndex];
+							_litColor[colorIndex].r = (int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536;
+							_litColor[colorIndex].g = (int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536;
+							_litColor[colorIndex].b = (int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536;
+							_litColor555[colorIndex] = convertColor(_litColor[colorIndex]);
+							_litColorStamp[colorIndex] = _currentLitColorStamp;
+						}
 
-						int bladeToScummVmConstant = 256 / 32;
-						color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+						if (lineHasScreenEffects) {
+							Color256 aescColor = { 0, 0, 0 };
+							_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
+
+							Color256 color = _litColor[colorIndex];
+							color.r += aescColor.r;
+							color.g += aescColor.g;
+							color.b += aescColor.b;
+							color555 = convertColor(color);
+						} else {
+							color555 = _litColor555[colorIndex];
+						}
 					}
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufLinePtr[x]) {
-							frameLinePtr[x] = color555;
-							zbufLinePtr[x] = (uint16)vertexZ;
+
+					uint16 z = (uint16)vertexZ;
+					uint16 *zbufPtr = zbufLinePtr + previousVertexX;
+					uint16 *framePtr = frameLinePtr + previousVertexX;
+					for (int count = vertexX - previousVertexX; count > 0; --count, ++zbufPtr, ++framePtr) {
+						if (z < *zbufPtr) {
+							*framePtr = color555;
+							*zbufPtr = z;
 						}
 					}
 				}
@@ -598,6 +629,11 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 	}
 }
 
+uint16 SliceRenderer::convertColor(const Color256 &color) const {
+	int bladeToScummVmConstant = 256 / 32;
+	return _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+}
+
 void SliceRenderer::drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer) {
 	Matrix4x3 mOffset(
 		1.0f, 0.0f, 0.0f, _framePos.x,
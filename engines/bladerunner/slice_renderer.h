@@ -89,6 +89,14 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	// Palette colors of the scanline being drawn with the lights and the set
+	// effects applied. Entries are only computed when first used, an entry
+	// is valid when its stamp matches the current one.
+	Color256 _litColor[256];
+	uint16   _litColor555[256];
+	uint32   _litColorStamp[256];
+	uint32   _currentLitColorStamp;
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
@@ -115,6 +123,7 @@ private:
 	void loadFrame(int animation, int frame);
 
 	void drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y);
+	uint16 convertColor(const Color256 &color) const;
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 };
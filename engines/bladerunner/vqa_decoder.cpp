@@ -149,11 +149,23 @@ VQADecoder::VQADecoder() {
 	_header.unk5         = 0;
 	_readingFrame        = -1;
 	_decodingFrame       = -1;
+	_nextPacket          = 0;
+
+	for (int i = 0; i < kPacketCacheSize; ++i) {
+		_packets[i].frame    = -1;
+		_packets[i].data     = nullptr;
+		_packets[i].size     = 0;
+		_packets[i].capacity = 0;
+	}
 }
 
 VQADecoder::~VQADecoder() {
 	for (uint i = 0; i < _codebooks.size(); ++i) {
 		delete[] _codebooks[i].data;
+		delete[] _codebooks[i].colors;
+	}
+	for (int i = 0; i < kPacketCacheSize; ++i) {
+		delete[] _packets[i].data;
 	}
 	delete _audioTrack;
 	delete _videoTrack;
@@ -275,11 +287,81 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 		error("VQADecoder::readFrame(): frame %d out of bounds, frame count is %d", frame, numFrames());
 	}
 
-	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
-	_s->seek(frameOffset);
-
 	_readingFrame = frame;
+
+	Packet *packet = getPacket(frame);
+	if (!packet) {
+		uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+		_s->seek(frameOffset);
+		readPacket(readFlags);
+		return;
+	}
+
+	Common::SeekableReadStream *fileStream = _s;
+	Common::MemoryReadStream packetStream(packet->data, packet->size);
+
+	_s = &packetStream;
 	readPacket(readFlags);
+	_s = fileStream;
+}
+
+void VQADecoder::prefetchFrame(int frame) {
+	if (frame < 0 || frame >= numFrames()) {
+		return;
+	}
+
+	getPacket(frame);
+}
+
+bool VQADecoder::isFrameCached(int frame) const {
+	for (int i = 0; i < kPacketCacheSize; ++i) {
+		if (_packets[i].frame == frame) {
+			return true;
+		}
+	}
+	return false;
+}
+
+VQADecoder::Packet *VQADecoder::getPacket(int frame) {
+	for (int i = 0; i < kPacketCacheSize; ++i) {
+		if (_packets[i].frame == frame) {
+			return &_packets[i];
+		}
+	}
+
+	// Frames are stored one after another, so the data of a frame ends
+	// where the next one begins
+	uint32 begin = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	uint32 end;
+	if (frame + 1 < numFrames()) {
+		end = 2 * (_frameInfo[frame + 1] & 0x0FFFFFFF);
+	} else {
+		end = _s->size();
+	}
+
+	if (end <= begin || end - begin > 0x100000) {
+		return nullptr;
+	}
+
+	Packet &packet = _packets[_nextPacket];
+	_nextPacket = (_nextPacket + 1) % kPacketCacheSize;
+
+	packet.frame = -1;
+	packet.size = end - begin;
+	if (packet.size > packet.capacity) {
+		delete[] packet.data;
+		packet.data = new uint8[packet.size];
+		packet.capacity = packet.size;
+	}
+
+	_s->seek(begin);
+	if (_s->read(packet.data, packet.size) != packet.size) {
+		warning("VQADecoder::getPacket(): Error reading frame %d", frame);
+		return nullptr;
+	}
+
+	packet.frame = frame;
+	return &packet;
 }
 
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
@@ -479,6 +561,7 @@ bool VQADecoder::readCINF(Common::SeekableReadStream *s, uint32 size) {
 		_codebooks[i].frame = s->readUint16LE();
 		_codebooks[i].size  = s->readUint32LE();
 		_codebooks[i].data  = nullptr;
+		_codebooks[i].colors = nullptr;
 
 		// debug("Codebook %2d: %4d %8d", i, _codebooks[i].frame, _codebooks[i].size);
 
@@ -608,6 +691,7 @@ VQADecoder::VQAVideoTrack::VQAVideoTrack(VQADecoder *vqaDecoder) {
 	_maxZBUFChunkSize = vqaDecoder->_maxZBUFChunkSize;
 
 	_codebook = nullptr;
+	_codebookColors = nullptr;
 	_cbfz     = nullptr;
 
 	_vpointerSize = 0;
@@ -829,8 +913,29 @@ bool VQADecoder::VQAVideoTrack::readVPTR(Common::SeekableReadStream *s, uint32 s
 	return true;
 }
 
+uint16 *VQADecoder::VQAVideoTrack::getCodebookColors(CodebookInfo &codebookInfo, const Graphics::PixelFormat &format) {
+	if (codebookInfo.colors && codebookInfo.colorsFormat == format) {
+		return codebookInfo.colors;
+	}
+
+	uint32 colorCount = _maxBlocks * _blockW * _blockH;
+	if (!codebookInfo.colors) {
+		codebookInfo.colors = new uint16[colorCount];
+	}
+
+	for (uint32 i = 0; i != colorCount; ++i) {
+		uint8 a, r, g, b;
+		gameDataPixelFormat().colorToARGB(READ_LE_UINT16(codebookInfo.data + 2 * i), a, r, g, b);
+		codebookInfo.colors[i] = (uint16)format.ARGBToColor(a, r, g, b);
+	}
+	codebookInfo.colorsFormat = format;
+
+	return codebookInfo.colors;
+}
+
 void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha) {
 	const uint8 *const block_src = &_codebook[2 * srcBlock * _blockW * _blockH];
+	const uint16 *const block_colors = &_codebookColors[srcBlock * _blockW * _blockH];
 
 	int blocks_per_line = _width / _blockW;
 
@@ -839,20 +944,24 @@ void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsig
 		uint32 dst_y = (dstBlock + i) / blocks_per_line * _blockH + _offsetY;
 
 		const uint8 *src_p = block_src;
+		const uint16 *colors_p = block_colors;
 
 		for (int y = 0; y != _blockH; ++y) {
-			for (int x = 0; x != _blockW; ++x) {
-				uint16 vqaColor = READ_LE_UINT16(src_p);
-				src_p += 2;
-
-				uint8 a, r, g, b;
-				gameDataPixelFormat().colorToARGB(vqaColor, a, r, g, b);
-				uint16 outColor = (uint16)surface->format.ARGBToColor(a, r, g, b);
-
-				if (!(alpha && a)) {
-					*(uint16 *)(surface->getBasePtr(dst_x + x, dst_y + y)) = outColor;
+			uint16 *dst_p = (uint16 *)surface->getBasePtr(dst_x, dst_y + y);
+
+			if (!alpha) {
+				memcpy(dst_p, colors_p, 2 * _blockW);
+			} else {
+				// The alpha bit of the game data marks transparent pixels
+				for (int x = 0; x != _blockW; ++x) {
+					if (!(READ_LE_UINT16(src_p + 2 * x) & 0x8000)) {
+						dst_p[x] = colors_p[x];
+					}
 				}
 			}
+
+			src_p += 2 * _blockW;
+			colors_p += _blockW;
 		}
 	}
 }
@@ -868,6 +977,8 @@ bool VQADecoder::VQAVideoTrack::decodeFrame(Graphics::Surface *surface) {
 	if (!_codebook || !_vpointer)
 		return false;
 
+	_codebookColors = getCodebookColors(codebookInfo, surface->format);
+
 	uint8 *src = _vpointer;
 	uint8 *end = _vpointer + _vpointerSize;
 
@@ -63,6 +63,13 @@ public:
 
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
 
+	/**
+	 * Read the data of a frame into the packet cache so that the next
+	 * readFrame() of it does not have to access the file.
+	 */
+	void prefetchFrame(int frame);
+	bool isFrameCached(int frame) const;
+
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
 	void                        decodeZBuffer(ZBuffer *zbuffer);
 	Audio::SeekableAudioStream *decodeAudioFrame();
@@ -132,6 +139,23 @@ public:
 		uint16  frame;
 		uint32  size;
 		uint8  *data;
+
+		// The codebook converted to the pixel format of the surface it was
+		// last drawn to
+		uint16                *colors;
+		Graphics::PixelFormat  colorsFormat;
+	};
+
+	// Raw data of recently read frames. The audio is read ahead by more than
+	// a dozen frames, so the cache covers that and the video reads of those
+	// frames come from memory.
+	static const int kPacketCacheSize = 16;
+
+	struct Packet {
+		int     frame;
+		uint8  *data;
+		uint32  size;
+		uint32  capacity;
 	};
 
 	class VQAVideoTrack;
@@ -146,6 +170,9 @@ public:
 
 	Common::Array<CodebookInfo> _codebooks;
 
+	Packet _packets[kPacketCacheSize];
+	int    _nextPacket;
+
 	uint32  *_frameInfo;
 
 	uint32   _maxVIEWChunkSize;
@@ -156,6 +183,7 @@ public:
 	VQAAudioTrack *_audioTrack;
 
 	void readPacket(uint readFlags);
+	Packet *getPacket(int frame);
 
 	bool readVQHD(Common::SeekableReadStream *s, uint32 size);
 	bool readMSCI(Common::SeekableReadStream *s, uint32 size);
@@ -215,6 +243,7 @@ public:
 		uint32  _maxZBUFChunkSize;
 
 		uint8   *_codebook;
+		uint16  *_codebookColors;
 		uint8   *_cbfz;
 		uint32   _zbufChunkSize;
 		uint8   *_zbufChunk;
@@ -232,6 +261,7 @@ public:
 		uint32   _screenEffectsDataSize;
 
 		void VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha = false);
+		uint16 *getCodebookColors(CodebookInfo &codebookInfo, const Graphics::PixelFormat &format);
 		bool decodeFrame(Graphics::Surface *surface);
 	};
 
@@ -27,6 +27,7 @@
 
 #include "audio/decoders/raw.h"
 
+#include "common/profiler.h"
 #include "common/system.h"
 
 namespace BladeRunner {
@@ -119,12 +120,26 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 		// _repeatsCount == 0, so return here at the end of the video, to release the resource
 		return result;
 	} else if (useTime && (now < _frameNextTime)) {
+		// Use the time until the next frame is due to read it ahead, also
+		// the beginning of the loop when it is about to start over
+		_decoder.prefetchFrame(_frameNext);
+		if (_frameNext == _frameEnd && (_repeatsCount != 0 || _frameEndQueued != -1)) {
+			_decoder.prefetchFrame(_frameBegin);
+		}
 		result = -1;
 	} else if (advanceFrame) {
+		PROFILER_ZONE(kProfilerTrackMain, "vqa decode");
+
+		uint64 decodeStart = _vm->_system->getMicros();
+		bool cached = _decoder.isFrameCached(_frameNext);
+
 		_frame = _frameNext;
 		_decoder.readFrame(_frameNext, kVQAReadVideo);
 		_decoder.decodeVideoFrame(customSurface != nullptr ? customSurface : _surface, _frameNext);
 
+		debugC(1, kDebugVideo, "VQAPlayer::update(): %s frame %d decoded in %u us%s", _name.c_str(), _frame,
+		       (uint)(_vm->_system->getMicros() - decodeStart), cached ? "" : ", read from file");
+
 		if (_hasAudio) {
 			int audioPreloadFrames = 14;
 			if (!_audioStarted) {
@@ -402,10 +402,42 @@ void Frame::readSprite(Common::SeekableSubReadStreamEndian &stream, uint16 offse
 
 }
 
+ChannelState::ChannelState() : enabled(false), mouseDown(false), castType(kCastTypeNull), castId(0), ink(kInkTypeCopy),
+		spriteType(0), width(0), height(0), foreColor(0), backColor(0), lineSize(0) {
+}
+
+bool ChannelState::looksLike(const ChannelState &state) const {
+	if (!enabled && !state.enabled)
+		return true;
+
+	return enabled == state.enabled && mouseDown == state.mouseDown && castType == state.castType &&
+		castId == state.castId && ink == state.ink && spriteType == state.spriteType &&
+		startPoint == state.startPoint && width == state.width && height == state.height &&
+		foreColor == state.foreColor && backColor == state.backColor && lineSize == state.lineSize;
+}
+
 void Frame::prepareFrame(Score *score) {
 	_drawRects.clear();
-	renderSprites(*score->_surface, false);
-	renderSprites(*score->_trailSurface, true);
+	captureChannelStates();
+
+	Common::Array<Common::Rect> dirtyRects;
+	bool fullRedraw = !computeDirtyRects(score, dirtyRects);
+
+	if (fullRedraw) {
+		for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+			_channelStates[i].bounds = Common::Rect();
+			_channelStates[i].hitRect = Common::Rect();
+		}
+
+		score->_surface->blitFrom(*score->_trailSurface);
+		renderSprites(*score->_surface, false);
+		renderSprites(*score->_trailSurface, true);
+	} else {
+		for (uint i = 0; i < dirtyRects.size(); i++)
+			score->_surface->blitFrom(*score->_trailSurface, dirtyRects[i], Common::Point(dirtyRects[i].left, dirtyRects[i].top));
+
+		renderSprites(*score->_surface, false, &dirtyRects);
+	}
 
 	if (_transType != 0)
 		// TODO Handle changing area case
@@ -415,7 +447,181 @@ void Frame::prepareFrame(Score *score) {
 		playSoundChannel();
 	}
 
-	g_system->copyRectToScreen(score->_surface->getPixels(), score->_surface->pitch, 0, 0, score->_surface->getBounds().width(), score->_surface->getBounds().height());
+	if (fullRedraw) {
+		g_system->copyRectToScreen(score->_surface->getPixels(), score->_surface->pitch, 0, 0, score->_surface->getBounds().width(), score->_surface->getBounds().height());
+	} else {
+		debugC(2, kDebugImages, "prepareFrame: Updating %d stage rects", dirtyRects.size());
+
+		for (uint i = 0; i < dirtyRects.size(); i++) {
+			const Common::Rect &r = dirtyRects[i];
+			g_system->copyRectToScreen(score->_surface->getBasePtr(r.left, r.top), score->_surface->pitch, r.left, r.top, r.width(), r.height());
+		}
+	}
+
+	score->_channelStates = _channelStates;
+	score->_stagePalette = _vm->getPalette();
+	score->_redrawAll = false;
+	_channelStates.clear();
+}
+
+void Frame::captureChannelStates() {
+	_channelStates.resize(CHANNEL_COUNT);
+
+	for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+		Sprite *sprite = _sprites[i];
+		ChannelState &state = _channelStates[i];
+
+		state = ChannelState();
+		if (!sprite->_enabled)
+			continue;
+
+		state.enabled = true;
+		state.castType = getSpriteCastType(i);
+		state.castId = sprite->_castId;
+		state.ink = sprite->_ink;
+		state.spriteType = sprite->_spriteType;
+		state.startPoint = sprite->_startPoint;
+		state.width = sprite->_width;
+		state.height = sprite->_height;
+		state.foreColor = sprite->_foreColor;
+		state.backColor = sprite->_backColor;
+		state.lineSize = sprite->_lineSize;
+		state.mouseDown = (_vm->getCurrentScore()->_currentMouseDownSpriteId == i);
+
+		// renderShape() forces the ink of these, do the same here so that
+		// they do not look changed on every frame.
+		if (state.castType == kCastShape && _vm->getVersion() <= 3 && state.spriteType == 0x0c)
+			state.ink = kInkTypeReverse;
+	}
+}
+
+static void addDirtyRect(Common::Array<Common::Rect> &dirtyRects, Common::Rect rect) {
+	if (rect.isEmpty())
+		return;
+
+	// Merge with all overlapping rects, so that the list stays disjoint
+	for (uint i = 0; i < dirtyRects.size(); ) {
+		if (dirtyRects[i].intersects(rect)) {
+			rect.extend(dirtyRects[i]);
+			dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	dirtyRects.push_back(rect);
+}
+
+bool Frame::computeDirtyRects(Score *score, Common::Array<Common::Rect> &dirtyRects) {
+	if (score->_redrawAll || _transType != 0 || score->_stagePalette != _vm->getPalette() ||
+			score->_channelStates.size() != CHANNEL_COUNT)
+		return false;
+
+	for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+		ChannelState &state = _channelStates[i];
+		const ChannelState &prev = score->_channelStates[i];
+
+		// Trails are drawn onto the background, which is not tracked
+		if (state.enabled && _sprites[i]->_trails)
+			return false;
+
+		if (state.looksLike(prev)) {
+			state.bounds = prev.bounds;
+			state.hitRect = prev.hitRect;
+			continue;
+		}
+
+		if (state.enabled && !predictSpriteBounds(i, state.bounds))
+			return false;
+
+		addDirtyRect(dirtyRects, prev.bounds);
+		addDirtyRect(dirtyRects, state.bounds);
+	}
+
+	// A sprite touching a dirty rect is drawn as a whole, which makes all of
+	// its area dirty. Repeat until no more sprites are pulled in.
+	bool grown = true;
+	while (grown) {
+		grown = false;
+
+		for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+			const Common::Rect &bounds = _channelStates[i].bounds;
+			if (bounds.isEmpty())
+				continue;
+
+			for (uint j = 0; j < dirtyRects.size(); j++) {
+				if (dirtyRects[j].intersects(bounds) && !dirtyRects[j].contains(bounds)) {
+					addDirtyRect(dirtyRects, bounds);
+					grown = true;
+					break;
+				}
+			}
+		}
+	}
+
+	const Common::Rect stage(score->_surface->w, score->_surface->h);
+	uint32 dirtyArea = 0;
+
+	for (uint i = 0; i < dirtyRects.size(); ) {
+		dirtyRects[i].clip(stage);
+		if (dirtyRects[i].isEmpty()) {
+			dirtyRects.remove_at(i);
+			continue;
+		}
+
+		dirtyArea += dirtyRects[i].width() * dirtyRects[i].height();
+		i++;
+	}
+
+	// Not worth the bookkeeping when most of the stage changes
+	if (dirtyArea > (uint32)stage.width() * stage.height() * 3 / 4)
+		return false;
+
+	return true;
+}
+
+bool Frame::predictSpriteBounds(uint16 spriteId, Common::Rect &bounds) {
+	Sprite *sprite = _sprites[spriteId];
+
+	switch (_channelStates[spriteId].castType) {
+	case kCastShape:
+		bounds = Common::Rect(sprite->_startPoint.x, sprite->_startPoint.y,
+			sprite->_startPoint.x + sprite->_width, sprite->_startPoint.y + sprite->_height);
+		return true;
+	case kCastText:
+	case kCastRTE:
+	case kCastButton:
+		// The size depends on the laid out text
+		return false;
+	default:
+		break;
+	}
+
+	if (!sprite->_bitmapCast) {
+		bounds = Common::Rect();
+		return true;
+	}
+
+	int x = sprite->_startPoint.x - sprite->_bitmapCast->regX + sprite->_bitmapCast->initialRect.left;
+	int y = sprite->_startPoint.y - sprite->_bitmapCast->regY + sprite->_bitmapCast->initialRect.top;
+	int width = _vm->getVersion() > 4 ? sprite->_bitmapCast->initialRect.width() : sprite->_width;
+	const Graphics::Surface *surface = sprite->_bitmapCast->surface;
+
+	// Same area as inkBasedBlit() covers
+	bounds = Common::Rect(x, y, x + MAX<int>(width, surface->w), y + MAX<int>(sprite->_height, surface->h));
+	return true;
+}
+
+void Frame::extendSpriteBounds(uint16 spriteId, const Common::Rect &rect) {
+	if (spriteId >= _channelStates.size() || rect.isEmpty())
+		return;
+
+	Common::Rect &bounds = _channelStates[spriteId].bounds;
+	if (bounds.isEmpty())
+		bounds = rect;
+	else
+		bounds.extend(rect);
 }
 
 void Frame::playSoundChannel() {
@@ -566,42 +772,72 @@ void Frame::playTransition(Score *score) {
 	}
 }
 
-void Frame::renderSprites(Graphics::ManagedSurface &surface, bool renderTrail) {
+CastType Frame::getSpriteCastType(uint16 spriteId) {
+	Sprite *sprite = _sprites[spriteId];
+	CastType castType = kCastTypeNull;
+
+	if (_vm->getVersion() < 4) {
+		debugC(1, kDebugImages, "Channel: %d type: %d", spriteId, sprite->_spriteType);
+		switch (sprite->_spriteType) {
+		case 1:
+			castType = kCastBitmap;
+			break;
+		case 2:
+		case 12: // this is actually a mouse-over shape? I don't think it's a real button.
+		case 16: // Face kit D3
+			castType = kCastShape;
+			break;
+		case 7:
+			castType = kCastText;
+			break;
+		}
+	} else {
+		if (!_vm->getCurrentScore()->_castTypes.contains(sprite->_castId)) {
+			if (!_vm->getSharedCastTypes()->contains(sprite->_castId)) {
+				warning("Cast id %d not found", sprite->_castId);
+				castType = kCastTypeNull;
+			} else {
+				warning("Getting cast id %d from shared cast", sprite->_castId);
+				castType = _vm->getSharedCastTypes()->getVal(sprite->_castId);
+			}
+		} else {
+			castType = _vm->getCurrentScore()->_castTypes[sprite->_castId];
+		}
+	}
+
+	return castType;
+}
+
+void Frame::renderSprites(Graphics::ManagedSurface &surface, bool renderTrail, const Common::Array<Common::Rect> *dirtyRects) {
 	for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
 		if (_sprites[i]->_enabled) {
 			if ((_sprites[i]->_trails == 0 && renderTrail) || (_sprites[i]->_trails == 1 && !renderTrail))
 				continue;
 
-			CastType castType = kCastTypeNull;
-			if (_vm->getVersion() < 4) {
-				debugC(1, kDebugImages, "Channel: %d type: %d", i, _sprites[i]->_spriteType);
-				switch (_sprites[i]->_spriteType) {
-				case 1:
-					castType = kCastBitmap;
-					break;
-				case 2:
-				case 12: // this is actually a mouse-over shape? I don't think it's a real button.
-				case 16: // Face kit D3
-					castType = kCastShape;
-					break;
-				case 7:
-					castType = kCastText;
-					break;
-				}
-			} else {
-				if (!_vm->getCurrentScore()->_castTypes.contains(_sprites[i]->_castId)) {
-					if (!_vm->getSharedCastTypes()->contains(_sprites[i]->_castId)) {
-						warning("Cast id %d not found", _sprites[i]->_castId);
-						continue;
-					} else {
-						warning("Getting cast id %d from shared cast", _sprites[i]->_castId);
-						castType = _vm->getSharedCastTypes()->getVal(_sprites[i]->_castId);
-					}
-				} else {
-					castType = _vm->getCurrentScore()->_castTypes[_sprites[i]->_castId];
+			ChannelState &state = _channelStates[i];
+
+			// Cast not found
+			if (_vm->getVersion() >= 4 && state.castType == kCastTypeNull)
+				continue;
+
+			if (dirtyRects) {
+				bool dirty = false;
+				for (uint j = 0; j < dirtyRects->size() && !dirty; j++)
+					dirty = (*dirtyRects)[j].intersects(state.bounds);
+
+				if (!dirty) {
+					// The sprite is still on the stage, keep it clickable
+					if (!state.hitRect.isEmpty())
+						addDrawRect(i, state.hitRect);
+					continue;
 				}
+
+				state.bounds = Common::Rect();
+				state.hitRect = Common::Rect();
 			}
 
+			CastType castType = state.castType;
+
 			// this needs precedence to be hit first... D3 does something really tricky with cast IDs for shapes.
 			// I don't like this implementation 100% as the 'cast' above might not actually hit a member and be null?
 			if (castType == kCastShape) {
@@ -639,6 +875,9 @@ void Frame::addDrawRect(uint16 spriteId, Common::Rect &rect) {
 	fi->spriteId = spriteId;
 	fi->rect = rect;
 	_drawRects.push_back(fi);
+
+	if (spriteId < _channelStates.size())
+		_channelStates[spriteId].hitRect = rect;
 }
 
 void Frame::renderShape(Graphics::ManagedSurface &surface, uint16 spriteId) {
@@ -696,12 +935,14 @@ void Frame::renderButton(Graphics::ManagedSurface &surface, uint16 spriteId) {
 		// Magic numbers: checkbox square need to move left about 5px from text and 12px side size (D4)
 		_rect = Common::Rect(x - 17, y, x + 12, y + 12);
 		surface.frameRect(_rect, 0);
+		extendSpriteBounds(spriteId, _rect);
 		addDrawRect(spriteId, _rect);
 		break;
 	case kTypeButton: {
 			_rect = Common::Rect(x, y, x + width, y + height + 3);
 			Graphics::MacPlotData pd(&surface, &_vm->getMacWindowManager()->getPatterns(), Graphics::MacGUIConstants::kPatternSolid, 1, Graphics::kColorWhite);
 			Graphics::drawRoundRect(_rect, 4, 0, false, Graphics::macDrawPixel, &pd);
+			extendSpriteBounds(spriteId, _rect);
 			addDrawRect(spriteId, _rect);
 		}
 		break;
@@ -712,6 +953,9 @@ void Frame::renderButton(Graphics::ManagedSurface &surface, uint16 spriteId) {
 }
 
 void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect) {
+	extendSpriteBounds(spriteId, Common::Rect(drawRect.left, drawRect.top,
+		drawRect.left + MAX<int>(drawRect.width(), spriteSurface.w), drawRect.top + MAX<int>(drawRect.height(), spriteSurface.h)));
+
 	switch (_sprites[spriteId]->_ink) {
 	case kInkTypeCopy:
 		targetSurface.blitFrom(spriteSurface, Common::Point(drawRect.left, drawRect.top));
@@ -724,7 +968,12 @@ void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics
 		drawBackgndTransSprite(targetSurface, spriteSurface, drawRect);
 		break;
 	case kInkTypeMatte:
-		drawMatteSprite(targetSurface, spriteSurface, drawRect);
+		{
+			BitmapCast *bitmapCast = _sprites[spriteId]->_bitmapCast;
+			// Only bitmap casts have a stable surface to cache the mask for
+			bool cacheMask = bitmapCast && bitmapCast->surface == &spriteSurface;
+			drawMatteSprite(targetSurface, spriteSurface, drawRect, cacheMask);
+		}
 		break;
 	case kInkTypeGhost:
 		drawGhostSprite(targetSurface, spriteSurface, drawRect);
@@ -914,8 +1163,7 @@ void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::
 	}
 }
 
-void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
-	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
+Graphics::Surface *Frame::createMatteMask(const Graphics::Surface &sprite) {
 	Graphics::Surface tmp;
 	tmp.copyFrom(sprite);
 
@@ -938,40 +1186,86 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 
 	if (whiteColor == -1) {
 		debugC(1, kDebugImages, "No white color for Matte image");
+		tmp.free();
+		return nullptr;
+	}
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+	Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++)
-				*dst = *src;
+	for (int yy = 0; yy < tmp.h; yy++) {
+		ff.addSeed(0, yy);
+		ff.addSeed(tmp.w - 1, yy);
+	}
+
+	for (int xx = 0; xx < tmp.w; xx++) {
+		ff.addSeed(xx, 0);
+		ff.addSeed(xx, tmp.h - 1);
+	}
+	ff.fillMask();
+
+	Graphics::Surface *mask = new Graphics::Surface();
+	mask->copyFrom(*ff.getMask());
+
+	tmp.free();
+	return mask;
+}
+
+void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect, bool cacheMask) {
+	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
+	Score *score = _vm->getCurrentScore();
+	const Graphics::Surface *mask;
+	Graphics::Surface *tmpMask = nullptr;
+
+	// The mask only depends on the bitmap and the palette, so keep it for
+	// bitmap casts instead of flood filling them on every frame. The size is
+	// checked as well, in case another bitmap took over the surface address.
+	if (cacheMask) {
+		MatteMask &entry = score->_matteMasks[&sprite];
+		if (entry.palette != _vm->getPalette() || entry.w != sprite.w || entry.h != sprite.h) {
+			if (entry.mask) {
+				entry.mask->free();
+				delete entry.mask;
+			}
+			entry.palette = _vm->getPalette();
+			entry.w = sprite.w;
+			entry.h = sprite.h;
+			entry.mask = createMatteMask(sprite);
 		}
+		mask = entry.mask;
 	} else {
-		Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
+		tmpMask = createMatteMask(sprite);
+		mask = tmpMask;
+	}
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			ff.addSeed(0, yy);
-			ff.addSeed(tmp.w - 1, yy);
-		}
+	if (mask && (mask->w != sprite.w || mask->h != sprite.h)) {
+		warning("Frame::drawMatteSprite(): Mask size %dx%d doesn't match sprite size %dx%d", mask->w, mask->h, sprite.w, sprite.h);
+		mask = nullptr;
+	}
 
-		for (int xx = 0; xx < tmp.w; xx++) {
-			ff.addSeed(xx, 0);
-			ff.addSeed(xx, tmp.h - 1);
-		}
-		ff.fillMask();
+	if (!mask) {
+		for (int yy = 0; yy < sprite.h; yy++) {
+			const byte *src = (const byte *)sprite.getBasePtr(0, yy);
+			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			const byte *mask = (const byte *)ff.getMask()->getBasePtr(0, yy);
+			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++)
+				*dst = *src;
+		}
+	} else {
+		for (int yy = 0; yy < sprite.h; yy++) {
+			const byte *src = (const byte *)sprite.getBasePtr(0, yy);
+			const byte *msk = (const byte *)mask->getBasePtr(0, yy);
 			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, mask++)
-				if (*mask == 0)
+			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, msk++)
+				if (*msk == 0)
 					*dst = *src;
 		}
 	}
 
-	tmp.free();
+	if (tmpMask) {
+		tmpMask->free();
+		delete tmpMask;
+	}
 }
 
 uint16 Frame::getSpriteIDFromPos(Common::Point pos) {
@@ -24,6 +24,8 @@
 #define DIRECTOR_FRAME_H
 
 #include "graphics/managed_surface.h"
+#include "director/cast.h"
+#include "director/sprite.h"
 
 namespace Image {
 	class ImageDecoder;
@@ -107,6 +109,34 @@ struct FrameEntity {
 	Common::Rect rect;
 };
 
+/**
+ * A sprite channel as it was last composited onto the stage. Comparing it
+ * with the channel of the next frame tells which parts of the stage have
+ * to be redrawn.
+ */
+struct ChannelState {
+	ChannelState();
+
+	/** Whether the channel looks the same, ignoring where it was drawn. */
+	bool looksLike(const ChannelState &state) const;
+
+	bool enabled;
+	bool mouseDown;
+	CastType castType;
+	uint16 castId;
+	InkType ink;
+	byte spriteType;
+	Common::Point startPoint;
+	uint16 width;
+	uint16 height;
+	byte foreColor;
+	byte backColor;
+	byte lineSize;
+
+	Common::Rect bounds;   ///< Stage area covered by the sprite, empty if nothing was drawn
+	Common::Rect hitRect;  ///< Rect registered for mouse hit tests, empty if none
+};
+
 
 class Frame {
 public:
@@ -124,7 +154,12 @@ public:
 private:
 	void playTransition(Score *score);
 	void playSoundChannel();
-	void renderSprites(Graphics::ManagedSurface &surface, bool renderTrail);
+	void renderSprites(Graphics::ManagedSurface &surface, bool renderTrail, const Common::Array<Common::Rect> *dirtyRects = nullptr);
+	CastType getSpriteCastType(uint16 spriteId);
+	void captureChannelStates();
+	bool computeDirtyRects(Score *score, Common::Array<Common::Rect> &dirtyRects);
+	bool predictSpriteBounds(uint16 spriteId, Common::Rect &bounds);
+	void extendSpriteBounds(uint16 spriteId, const Common::Rect &rect);
 	void renderText(Graphics::ManagedSurface &surface, uint16 spriteId, Common::Rect *textSize);
 	void renderShape(Graphics::ManagedSurface &surface, uint16 spriteId);
 	void renderButton(Graphics::ManagedSurface &surface, uint16 spriteId);
@@ -134,7 +169,8 @@ private:
 	Image::ImageDecoder *getImageFrom(uint16 spriteId);
 	Common::String readTextStream(Common::SeekableSubReadStreamEndian *textStream, TextCast *textCast);
 	void drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
-	void drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
+	void drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect, bool cacheMask);
+	Graphics::Surface *createMatteMask(const Graphics::Surface &sprite);
 	void drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
 	void drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
 	void inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect);
@@ -160,6 +196,10 @@ public:
 	Common::Array<Sprite *> _sprites;
 	Common::Array<FrameEntity *> _drawRects;
 	DirectorEngine *_vm;
+
+private:
+	/** Channel states of the stage being composited, only valid during prepareFrame() */
+	Common::Array<ChannelState> _channelStates;
 };
 
 } // End of namespace Director
@@ -255,10 +255,27 @@ void Lingo::c_arraypush() {
 }
 
 void Lingo::c_varpush() {
-	Common::String name((char *)&(*g_lingo->_currentScript)[g_lingo->_pc]);
+	const char *code = (const char *)&(*g_lingo->_currentScript)[g_lingo->_pc];
 	Datum d;
 
-	g_lingo->_pc += g_lingo->calcStringAlignment(name.c_str());
+	// Fast path: this reference was already resolved in the current set of
+	// local variables, so skip the name hashing entirely
+	if (!g_lingo->_immediateMode && g_lingo->_localvarsId) {
+		VarCache::const_iterator cached = g_lingo->_varCache.find(code);
+		if (cached != g_lingo->_varCache.end() && cached->_value.localvarsId == g_lingo->_localvarsId) {
+			g_lingo->_pc += cached->_value.codeSize;
+
+			d.type = VAR;
+			d.u.sym = cached->_value.sym;
+			g_lingo->push(d);
+			return;
+		}
+	}
+
+	Common::String name(code);
+	uint codeSize = g_lingo->calcStringAlignment(code);
+
+	g_lingo->_pc += codeSize;
 
 	// In immediate mode we will push variables as strings
 	// This is used for playAccel
@@ -285,6 +302,16 @@ void Lingo::c_varpush() {
 		d.u.i = val;
 	} else {
 		d.type = VAR;
+
+		// Only local variables are cached. Event handler names depend on
+		// the current entity, so those are always looked up.
+		if (g_lingo->_localvarsId && g_lingo->_localvars->contains(name) &&
+				!g_lingo->_eventHandlerTypeIds.contains(name)) {
+			VarCacheEntry &entry = g_lingo->_varCache[code];
+			entry.localvarsId = g_lingo->_localvarsId;
+			entry.sym = d.u.sym;
+			entry.codeSize = codeSize;
+		}
 	}
 
 	g_lingo->push(d);
@@ -1110,9 +1137,11 @@ void Lingo::call(Common::String name, int nargs) {
 	fp->retpc = g_lingo->_pc;
 	fp->retscript = g_lingo->_currentScript;
 	fp->localvars = g_lingo->_localvars;
+	fp->localvarsId = g_lingo->_localvarsId;
 
 	// Create new set of local variables
 	g_lingo->_localvars = new SymbolHash;
+	g_lingo->_localvarsId = ++g_lingo->_nextLocalvarsId;
 
 	g_lingo->_callstack.push_back(fp);
 
@@ -1141,6 +1170,7 @@ void Lingo::c_procret() {
 
 	// Restore local variables
 	g_lingo->_localvars = fp->localvars;
+	g_lingo->_localvarsId = fp->localvarsId;
 
 	delete fp;
 
@@ -1158,6 +1188,9 @@ void Lingo::c_global() {
 	s = g_lingo->lookupVar(name.c_str(), true, true);
 	s->global = true;
 
+	// Cached references may point to a shadowed local variable
+	g_lingo->_localvarsId = ++g_lingo->_nextLocalvarsId;
+
 	g_lingo->_pc += g_lingo->calcStringAlignment(name.c_str());
 }
 
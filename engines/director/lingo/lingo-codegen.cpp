@@ -54,12 +54,14 @@ namespace Director {
 
 void Lingo::execute(uint pc) {
 	for(_pc = pc; (*_currentScript)[_pc] != STOP && !_returning;) {
-		Common::String instr = decodeInstruction(_pc);
-
 		if (debugChannelSet(5, kDebugLingoExec))
 			printStack("Stack before: ");
 
-		debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+		// Decoding is expensive, so only do it when it's going to be printed
+		if (debugChannelSet(1, kDebugLingoExec)) {
+			Common::String instr = decodeInstruction(_pc);
+			debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+		}
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
@@ -205,6 +207,7 @@ void Lingo::cleanLocalVars() {
 	delete g_lingo->_localvars;
 
 	g_lingo->_localvars = 0;
+	g_lingo->_localvarsId = 0;
 }
 
 void Lingo::define(Common::String &name, int start, int nargs, Common::String *prefix, int end) {
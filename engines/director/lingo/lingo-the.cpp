@@ -737,6 +737,10 @@ void Lingo::setTheCast(Datum &id1, int field, Datum &d) {
 		return;
 	}
 
+	// Cast properties are not tracked by the stage compositor
+	_vm->getCurrentScore()->invalidateStage();
+	_vm->getCurrentScore()->clearMatteMasks();
+
 	switch (field) {
 	case kTheCastType:
 		// TODO: You can actually switch the cast type!?
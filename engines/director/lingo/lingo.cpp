@@ -23,6 +23,7 @@
 #include "common/archive.h"
 #include "common/file.h"
 #include "common/str-array.h"
+#include "common/system.h"
 
 #include "director/lingo/lingo.h"
 #include "director/lingo/lingo-gr.h"
@@ -68,6 +69,8 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 	_exitRepeat = false;
 
 	_localvars = NULL;
+	_localvarsId = 0;
+	_nextLocalvarsId = 0;
 
 	initEventHandlerTypes();
 
@@ -125,6 +128,9 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 		delete _scripts[type][id];
 	}
 
+	// The new code may redefine handlers, and the cache is keyed by code addresses
+	_varCache.clear();
+
 	_currentScript = new ScriptData;
 	_currentScriptType = type;
 	_scripts[type][id] = _currentScript;
@@ -215,6 +221,7 @@ void Lingo::executeScript(ScriptType type, uint16 id) {
 	_returning = false;
 
 	_localvars = new SymbolHash;
+	_localvarsId = ++_nextLocalvarsId;
 
 	execute(_pc);
 
@@ -231,6 +238,8 @@ void Lingo::restartLingo() {
 		_scripts[i].clear();
 	}
 
+	_varCache.clear();
+
 	// TODO
 	//
 	// reset the following:
@@ -390,10 +399,15 @@ void Lingo::runTests() {
 			_hadError = false;
 			addCode(script, kMovieScript, counter);
 
-			if (!_hadError)
+			if (!_hadError) {
+				uint32 startTime = g_system->getMillis();
+
 				executeScript(kMovieScript, counter);
-			else
+
+				debug(">> Executed in %d ms", g_system->getMillis() - startTime);
+			} else {
 				debug(">> Skipping execution");
+			}
 
 			free(script);
 
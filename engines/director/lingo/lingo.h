@@ -153,8 +153,26 @@ struct CFrame {	/* proc/func call stack frame */
 	int		retpc;	/* where to resume after return */
 	ScriptData	*retscript;	 /* which script to resume after return */
 	SymbolHash *localvars;
+	uint32	localvarsId;	/* serial number of localvars, see VarCacheEntry */
 };
 
+/**
+ * Inline cache entry for a variable reference in the compiled code, keyed
+ * by the address of the inlined variable name.
+ *
+ * An entry is only valid within the set of local variables it was filled in,
+ * which is identified by a serial number, because every handler invocation
+ * gets its own set. Compiling code may define new handlers shadowing the
+ * variables, so the whole cache is dropped in that case.
+ */
+struct VarCacheEntry {
+	uint32 localvarsId;
+	Symbol *sym;
+	uint codeSize;	/* aligned size of the inlined name, in insts */
+};
+
+typedef Common::HashMap<const void *, VarCacheEntry> VarCache;
+
 class Lingo {
 public:
 	Lingo(DirectorEngine *vm);
@@ -554,6 +572,10 @@ private:
 
 	SymbolHash _globalvars;
 	SymbolHash *_localvars;
+	uint32 _localvarsId;
+	uint32 _nextLocalvarsId;
+
+	VarCache _varCache;
 
 	FuncHash _functions;
 
@@ -84,6 +84,8 @@ Score::Score(DirectorEngine *vm) {
 	_flags = 0;
 	_stopPlay = false;
 	_stageColor = 0;
+	_stagePalette = nullptr;
+	_redrawAll = true;
 
 	_loadedBitmaps = new Common::HashMap<int, BitmapCast *>();
 	_loadedText = new Common::HashMap<int, TextCast *>();
@@ -290,6 +292,8 @@ Score::~Score() {
 	delete _surface;
 	delete _trailSurface;
 
+	clearMatteMasks();
+
 	if (_movieArchive)
 		_movieArchive->close();
 
@@ -718,7 +722,19 @@ Common::Rect Score::getCastMemberInitialRect(int castId) {
 	}
 }
 
+void Score::clearMatteMasks() {
+	for (Common::HashMap<const Graphics::Surface *, MatteMask>::iterator it = _matteMasks.begin(); it != _matteMasks.end(); ++it) {
+		if (it->_value.mask) {
+			it->_value.mask->free();
+			delete it->_value.mask;
+		}
+	}
+	_matteMasks.clear();
+}
+
 void Score::setCastMemberModified(int castId) {
+	invalidateStage();
+
 	switch (_castTypes[castId]) {
 	case kCastBitmap:
 		_loadedBitmaps->getVal(castId)->modified = 1;
@@ -1183,6 +1199,7 @@ void Score::startLoop() {
 	_currentFrame = 0;
 	_stopPlay = false;
 	_nextFrameTime = 0;
+	invalidateStage();
 
 	_frames[_currentFrame]->prepareFrame(this);
 
@@ -1199,9 +1216,6 @@ void Score::update() {
 	if (g_system->getMillis() < _nextFrameTime)
 		return;
 
-	_surface->clear();
-	_surface->copyFrom(*_trailSurface);
-
 	_lingo->executeImmediateScripts(_frames[_currentFrame]);
 
 	// Enter and exit from previous frame (Director 4)
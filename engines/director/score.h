@@ -23,6 +23,7 @@
 #ifndef DIRECTOR_SCORE_H
 #define DIRECTOR_SCORE_H
 
+#include "common/hash-ptr.h"
 #include "common/substream.h"
 #include "common/rect.h"
 #include "director/archive.h"
@@ -45,6 +46,7 @@ class Frame;
 struct Label;
 class Lingo;
 class Sprite;
+struct ChannelState;
 
 enum ScriptType {
 	kMovieScript = 0,
@@ -58,6 +60,14 @@ enum ScriptType {
 
 const char *scriptType2str(ScriptType scr);
 
+struct MatteMask {
+	MatteMask() : palette(nullptr), w(0), h(0), mask(nullptr) {}
+
+	const byte *palette;       ///< Palette the mask was built with
+	int16 w, h;                ///< Size of the bitmap the mask was built for
+	Graphics::Surface *mask;   ///< Pixels to skip, nullptr if the bitmap has no white border
+};
+
 class Score {
 public:
 	Score(DirectorEngine *vm);
@@ -89,6 +99,8 @@ public:
 	void loadCastInto(Sprite *sprite, int castId);
 	Common::Rect getCastMemberInitialRect(int castId);
 	void setCastMemberModified(int castId);
+	void invalidateStage() { _redrawAll = true; }
+	void clearMatteMasks();
 
 	int getPreviousLabelNumber(int referenceFrame);
 	int getCurrentLabelNumber();
@@ -137,6 +149,12 @@ public:
 	Common::HashMap<int, ScriptCast *> *_loadedScripts;
 	Common::HashMap<int, const Stxt *> *_loadedStxts;
 
+	// Stage compositing state, see Frame::prepareFrame()
+	Common::Array<ChannelState> _channelStates;
+	const byte *_stagePalette;
+	bool _redrawAll;
+	Common::HashMap<const Graphics::Surface *, MatteMask> _matteMasks;	///< Keyed by bitmap cast surface
+
 private:
 	uint16 _versionMinor;
 	uint16 _versionMajor;
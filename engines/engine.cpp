@@ -40,6 +40,7 @@
 #include "common/error.h"
 #include "common/list.h"
 #include "common/memstream.h"
+#include "common/profiler.h"
 #include "common/scummsys.h"
 #include "common/taskbar.h"
 #include "common/textconsole.h"
@@ -492,6 +493,8 @@ void Engine::errorString(const char *buf1, char *buf2, int size) {
 void Engine::pauseEngine(bool pause) {
 	assert((pause && _pauseLevel >= 0) || (!pause && _pauseLevel));
 
+	PROFILER_ZONE(kProfilerTrackMain, "pauseEngine");
+
 	if (pause)
 		_pauseLevel++;
 	else
@@ -49,44 +49,61 @@ void Glulxe::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+		if (instrcache && pc < ramstart) {
+			/* Code in ROM never changes, so its decoded form can be reused. */
+			cachedinstr_t *entry = &instrcache[pc & (INSTR_CACHE_SIZE - 1)];
+			if (entry->addr != pc) {
+				cache_instruction(entry, pc);
+
+				/* An instruction reaching into RAM could still change. */
+				if (entry->nextpc > ramstart)
+					entry->addr = 0;
 			}
-		}
 
-		/* Now we have an opcode number. */
+			opcode = entry->opcode;
+			oplist = entry->oplist;
+			pc = entry->nextpc;
+			load_cached_operands(inst, entry);
+		} else {
+			/* Fetch the opcode number. */
+			opcode = Mem1(pc);
+			pc++;
+			if (opcode & 0x80) {
+				/* More than one-byte opcode. */
+				if (opcode & 0x40) {
+					/* Four-byte opcode */
+					opcode &= 0x3F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				} else {
+					/* Two-byte opcode */
+					opcode &= 0x7F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				}
+			}
+
+			/* Now we have an opcode number. */
 
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
+			/* Fetch the structure that describes how the operands for this
+			   opcode are arranged. This is a pointer to an immutable,
+			   static object. */
+			if (opcode < 0x80)
+				oplist = fast_operandlist[opcode];
+			else
+				oplist = lookup_operandlist(opcode);
 
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
+			if (!oplist)
+				fatal_error_i("Encountered unknown opcode.", opcode);
 
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+			/* Based on the oplist structure, load the actual operand values
+			   into inst. This moves the PC up to the end of the instruction. */
+			parse_operands(inst, oplist);
+		}
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
@@ -354,9 +371,9 @@ PerformJump: /* goto label for successful jumping... ironic, no? */
 				goto PerformJump;
 				break;
 			case op_throw:
-				profile_fail("throw");
 				value = inst[0].value;
 				stackptr = inst[1].value;
+				profile_unwind(stackptr);
 				pop_callstub(value);
 				break;
 
@@ -664,7 +681,7 @@ PerformJump: /* goto label for successful jumping... ironic, no? */
 				break;
 
 			case op_restart:
-				profile_fail("restart");
+				profile_unwind(0);
 				vm_restart();
 				break;
 
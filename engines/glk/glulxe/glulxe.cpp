@@ -43,6 +43,10 @@ Glulxe::Glulxe(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst,
 		accelentries(nullptr),
 		// heap
 		heap_start(0), alloc_count(0), heap_head(nullptr), heap_tail(nullptr),
+		// operand
+		instrcache(nullptr),
+		// profile
+		profile_active(false), profile_opcount(0),
 		// serial
 		max_undo_level(8), undo_chain_size(0), undo_chain_num(0), undo_chain(nullptr), ramcache(nullptr),
 		// string
@@ -63,6 +67,7 @@ void Glulxe::runGame() {
 	if (library_autorestore_hook)
 		library_autorestore_hook();
 
+	init_profile();
 	execute_loop();
 	finalize_vm();
 
@@ -24,6 +24,8 @@
 #define GLK_GLULXE
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/random.h"
 #include "glk/glk_api.h"
 #include "glk/glulxe/glulxe_types.h"
@@ -142,6 +144,23 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Direct mapped cache of decoded instructions, indexed by the low bits of their address
+	 */
+	cachedinstr_t *instrcache;
+
+	/**@}*/
+
+	/**
+	 * \defgroup profile fields
+	 * @{
+	 */
+
+	bool profile_active;
+	uint64 profile_opcount;
+	Common::HashMap<uint, profilefunc_t> profile_functions;
+	Common::Array<profileframe_t> profile_stack;
+
 	/**@}*/
 
 	/**
@@ -543,6 +562,23 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Decode the instruction at the given address into a cache entry, without
+	 * changing the PC or the stack. Load operands are left as their addressing mode.
+	 */
+	void cache_instruction(cachedinstr_t *entry, uint addr);
+
+	/**
+	 * Like parse_operands(), but for an instruction decoded with cache_instruction().
+	 * This doesn't change the PC.
+	 */
+	void load_cached_operands(oparg_t *opargs, const cachedinstr_t *entry);
+
+	/**
+	 * Empty the decoded instruction cache
+	 */
+	void clear_instruction_cache();
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
@@ -807,26 +843,37 @@ public:
 	 * @{
 	 */
 
-	void setup_profile(strid_t stream, char *filename);
-	int init_profile();
-	void profile_set_call_counts(int flag);
+	/**
+	 * Set up profiling, if the "profile" debug channel is enabled
+	 */
+	void init_profile();
+
+	/**
+	 * Count an executed instruction
+	 */
+	void profile_tick() { profile_opcount++; }
+
+	bool profile_profiling_active() const { return profile_active; }
+
+	/**
+	 * Called when a function, or a Glk call or output opcode, is entered
+	 */
+	void profile_in(uint addr, uint stackuse, bool accel);
 
-	#if VM_PROFILING
-	uint profile_opcount;
-	#define profile_tick() (profile_opcount++)
-	int profile_profiling_active();
-	void profile_in(uint addr, uint stackuse, int accel);
+	/**
+	 * Called when the innermost function being profiled returns
+	 */
 	void profile_out(uint stackuse);
-	void profile_fail(const char *reason);
+
+	/**
+	 * Drop the functions that a throw unwound, given the stack position it unwound to
+	 */
+	void profile_unwind(uint stackuse);
+
+	/**
+	 * Print the functions that executed the most instructions
+	 */
 	void profile_quit();
-	#else /* VM_PROFILING */
-	void profile_tick() {}
-	void profile_profiling_active() {}
-	void profile_in(uint addr, uint stackuse, int accel) {}
-	void profile_out(uint stackuse)  {}
-	void profile_fail(const char *reason) {}
-	void profile_quit() {}
-	#endif /* VM_PROFILING */
 
 #if VM_DEBUGGER
 	unsigned long debugger_opcount;
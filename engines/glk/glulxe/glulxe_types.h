@@ -352,6 +352,56 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * Number of slots in the decoded instruction cache. Must be a power of two.
+ */
+#define INSTR_CACHE_SIZE (16384)
+
+/**
+ * How a load operand of a cached instruction gets its value. Store operands keep
+ * the desttype of oparg_t instead.
+ */
+enum cachedmode {
+	cachedmode_Const = 0,   ///< value is the operand itself
+	cachedmode_Stack = 1,   ///< pop the operand off the stack
+	cachedmode_Mem = 2,     ///< value is a main memory address
+	cachedmode_Locals = 3   ///< value is an offset in the locals segment
+};
+
+/**
+ * An instruction whose opcode and operand modes have already been decoded. Only
+ * instructions in ROM are cached, which can't be written to, so entries never have
+ * to be invalidated.
+ */
+struct cachedinstr_struct {
+	uint addr;                  ///< Address of the instruction, 0 for an empty slot
+	uint opcode;
+	uint nextpc;                ///< Address of the following instruction
+	const operandlist_t *oplist;
+	oparg_t operands[MAX_OPERANDS];
+};
+typedef cachedinstr_struct cachedinstr_t;
+
+/**
+ * Call statistics for one function, gathered when the "profile" debug channel is enabled
+ */
+struct profilefunc_struct {
+	uint addr;
+	uint calls;
+	uint64 totalops;            ///< Instructions executed by the function and its callees
+	uint64 selfops;             ///< Instructions executed by the function itself
+	bool accel;                 ///< Whether the function is handled natively
+};
+typedef profilefunc_struct profilefunc_t;
+
+struct profileframe_struct {
+	uint addr;
+	uint stackuse;
+	uint64 startops;
+	uint64 childops;
+};
+typedef profileframe_struct profileframe_t;
+
 typedef uint(Glulxe::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
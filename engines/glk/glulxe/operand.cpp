@@ -516,6 +516,231 @@ WrLocalsAddr:
 	}
 }
 
+void Glulxe::clear_instruction_cache() {
+	if (!instrcache) {
+		instrcache = (cachedinstr_t *)glulx_malloc(INSTR_CACHE_SIZE * sizeof(cachedinstr_t));
+		if (!instrcache)
+			return;
+	}
+
+	for (int ix = 0; ix < INSTR_CACHE_SIZE; ix++)
+		instrcache[ix].addr = 0;
+}
+
+void Glulxe::cache_instruction(cachedinstr_t *entry, uint addr) {
+	uint opcode;
+	const operandlist_t *oplist;
+	int ix;
+	oparg_t *curarg;
+	uint modeaddr;
+	int modeval = 0;
+
+	entry->addr = addr;
+
+	/* Fetch the opcode number, the same way execute_loop() does. */
+	opcode = Mem1(addr);
+	addr++;
+	if (opcode & 0x80) {
+		if (opcode & 0x40) {
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(addr);
+			opcode = (opcode << 8) | Mem1(addr + 1);
+			opcode = (opcode << 8) | Mem1(addr + 2);
+			addr += 3;
+		} else {
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		}
+	}
+
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	entry->opcode = opcode;
+	entry->oplist = oplist;
+
+	/* Decode the operand modes and their immediate data, like parse_operands()
+	   does. Anything which has to be read at execution time (the stack, main
+	   memory and locals) is only recorded. */
+	modeaddr = addr;
+	addr += (oplist->num_ops + 1) >> 1;
+
+	for (ix = 0, curarg = entry->operands; ix < oplist->num_ops; ix++, curarg++) {
+		int mode;
+		uint value;
+
+		if ((ix & 1) == 0) {
+			modeval = Mem1(modeaddr);
+			mode = (modeval & 0x0F);
+		} else {
+			mode = ((modeval >> 4) & 0x0F);
+			modeaddr++;
+		}
+
+		/* Read the immediate data of the operand. */
+		switch (mode) {
+		case 0:
+		case 8:
+			value = 0;
+			break;
+		case 1:
+			value = (int)(signed char)(Mem1(addr));
+			addr++;
+			break;
+		case 2:
+			value = (int)(signed char)(Mem1(addr));
+			value = (value << 8) | (uint)(Mem1(addr + 1));
+			addr += 2;
+			break;
+		case 3:
+		case 7:
+		case 11:
+		case 15:
+			value = Mem4(addr);
+			addr += 4;
+			break;
+		case 6:
+		case 10:
+		case 14:
+			value = (uint)Mem2(addr);
+			addr += 2;
+			break;
+		case 5:
+		case 9:
+		case 13:
+			value = (uint)(Mem1(addr));
+			addr++;
+			break;
+		default:
+			value = 0;
+			break;
+		}
+
+		if (mode >= 13 && mode <= 15)
+			value += ramstart;
+
+		if (oplist->formlist[ix] == modeform_Load) {
+			switch (mode) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				curarg->desttype = cachedmode_Const;
+				break;
+			case 8:
+				curarg->desttype = cachedmode_Stack;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				curarg->desttype = cachedmode_Mem;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				curarg->desttype = cachedmode_Locals;
+				break;
+			default:
+				fatal_error("Unknown addressing mode in load operand.");
+			}
+		} else { /* modeform_Store */
+			switch (mode) {
+			case 0:
+				curarg->desttype = 0;
+				break;
+			case 8:
+				curarg->desttype = 3;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				curarg->desttype = 1;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				curarg->desttype = 2;
+				break;
+			case 1:
+			case 2:
+			case 3:
+				fatal_error("Constant addressing mode in store operand.");
+				break;
+			default:
+				fatal_error("Unknown addressing mode in store operand.");
+			}
+		}
+
+		curarg->value = value;
+	}
+
+	entry->nextpc = addr;
+}
+
+void Glulxe::load_cached_operands(oparg_t *opargs, const cachedinstr_t *entry) {
+	const operandlist_t *oplist = entry->oplist;
+	const oparg_t *cachedarg = entry->operands;
+	int argsize = oplist->arg_size;
+	uint addr;
+
+	for (int ix = 0; ix < oplist->num_ops; ix++, cachedarg++, opargs++) {
+		if (oplist->formlist[ix] != modeform_Load) {
+			*opargs = *cachedarg;
+			continue;
+		}
+
+		opargs->desttype = 0;
+
+		switch (cachedarg->desttype) {
+		case cachedmode_Const:
+			opargs->value = cachedarg->value;
+			break;
+
+		case cachedmode_Stack:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			opargs->value = Stk4(stackptr);
+			break;
+
+		case cachedmode_Mem:
+			addr = cachedarg->value;
+			if (argsize == 4) {
+				opargs->value = Mem4(addr);
+			} else if (argsize == 2) {
+				opargs->value = Mem2(addr);
+			} else {
+				opargs->value = Mem1(addr);
+			}
+			break;
+
+		default: /* cachedmode_Locals */
+			addr = cachedarg->value + localsbase;
+			if (argsize == 4) {
+				opargs->value = Stk4(addr);
+			} else if (argsize == 2) {
+				opargs->value = Stk2(addr);
+			} else {
+				opargs->value = Stk1(addr);
+			}
+			break;
+		}
+	}
+}
+
 void Glulxe::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
@@ -0,0 +1,120 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "glk/glulxe/glulxe.h"
+#include "common/algorithm.h"
+#include "common/debug-channels.h"
+
+namespace Glk {
+namespace Glulxe {
+
+/**
+ * Number of functions listed by profile_quit()
+ */
+#define PROFILE_REPORT_COUNT (20)
+
+static bool profile_compare(const profilefunc_t &f1, const profilefunc_t &f2) {
+	return f1.selfops > f2.selfops;
+}
+
+void Glulxe::init_profile() {
+	profile_active = DebugMan.isDebugChannelEnabled(kDebugProfile);
+	profile_functions.clear();
+	profile_stack.clear();
+}
+
+void Glulxe::profile_in(uint addr, uint stackuse, bool accel) {
+	if (!profile_active)
+		return;
+
+	profilefunc_t &func = profile_functions.getVal(addr);
+	if (!func.calls) {
+		func.addr = addr;
+		func.totalops = 0;
+		func.selfops = 0;
+		func.accel = accel;
+	}
+	func.calls++;
+
+	profileframe_t frame;
+	frame.addr = addr;
+	frame.stackuse = stackuse;
+	frame.startops = profile_opcount;
+	frame.childops = 0;
+	profile_stack.push_back(frame);
+}
+
+void Glulxe::profile_out(uint stackuse) {
+	if (!profile_active || profile_stack.empty())
+		return;
+
+	profileframe_t frame = profile_stack.back();
+	profile_stack.pop_back();
+
+	uint64 ops = profile_opcount - frame.startops;
+	profilefunc_t &func = profile_functions.getVal(frame.addr);
+	func.totalops += ops;
+	func.selfops += ops - frame.childops;
+
+	if (!profile_stack.empty())
+		profile_stack.back().childops += ops;
+}
+
+void Glulxe::profile_unwind(uint stackuse) {
+	while (profile_active && !profile_stack.empty() && profile_stack.back().stackuse >= stackuse)
+		profile_out(stackuse);
+}
+
+void Glulxe::profile_quit() {
+	if (!profile_active)
+		return;
+
+	profile_unwind(0);
+
+	Common::Array<profilefunc_t> funcs;
+	for (Common::HashMap<uint, profilefunc_t>::const_iterator it = profile_functions.begin();
+			it != profile_functions.end(); ++it)
+		funcs.push_back(it->_value);
+	Common::sort(funcs.begin(), funcs.end(), profile_compare);
+
+	debug("Glulxe profile: %u functions, %llu instructions", funcs.size(), (unsigned long long)profile_opcount);
+	debug("     address      calls   self instrs  total instrs");
+
+	for (uint ix = 0; ix < funcs.size() && ix < PROFILE_REPORT_COUNT; ix++) {
+		const profilefunc_t &func = funcs[ix];
+		const char *kind = "";
+		if (func.accel)
+			kind = " (accelerated)";
+		else if (func.addr >= 0xF0000000)
+			kind = " (glk)";
+		else if (func.addr >= 0xE0000000)
+			kind = " (output)";
+
+		debug("  0x%08x %10u %13llu %13llu%s", func.addr, func.calls,
+			(unsigned long long)func.selfops, (unsigned long long)func.totalops, kind);
+	}
+
+	profile_active = false;
+}
+
+} // End of namespace Glulxe
+} // End of namespace Glk
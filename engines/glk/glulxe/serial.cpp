@@ -174,12 +174,6 @@ uint Glulxe::perform_restoreundo() {
 	uint heapsumlen = 0;
 	uint *heapsumarr = nullptr;
 
-	/* If profiling is enabled and active then fail. */
-#if VM_PROFILING
-	if (profile_profiling_active())
-		return 1;
-#endif /* VM_PROFILING */
-
 	if (undo_chain_size == 0 || undo_chain_num == 0)
 		return 1;
 
@@ -217,7 +211,9 @@ uint Glulxe::perform_restoreundo() {
 	}
 
 	if (res == 0) {
-		/* It worked. */
+		/* It worked. The profiler's call stack belongs to the replaced
+		   VM stack, so close all of its functions. */
+		profile_unwind(0);
 		if (undo_chain_size > 1)
 			memmove(undo_chain, undo_chain + 1,
 			        (undo_chain_size - 1) * sizeof(unsigned char *));
@@ -370,12 +366,6 @@ Common::Error Glulxe::readSaveData(Common::SeekableReadStream *rs) {
 	uint *heapsumarr = nullptr;
 	bool fromshell = false;
 #ifdef TODO
-	/* If profiling is enabled and active then fail. */
-#if VM_PROFILING
-	if (profile_profiling_active())
-		return 1;
-#endif /* VM_PROFILING */
-
 	stream_get_iosys(&val, &lx);
 	if (val != 2 && !fromshell) {
 		/* Not using the Glk I/O system, so bail. This function only
@@ -475,6 +465,9 @@ Common::Error Glulxe::readSaveData(Common::SeekableReadStream *rs) {
 
 	if (res)
 		return Common::kUnknownError;
+
+	/* The profiler's call stack belongs to the replaced VM stack */
+	profile_unwind(0);
 #endif
 	return Common::kNoError;
 }
@@ -90,6 +90,7 @@ void Glulxe::setup_vm() {
 
 	// Initialize various other things in the terp.
 	init_operands();
+	clear_instruction_cache();
 	init_serial();
 
 	// Set up the initial machine state.
@@ -115,6 +116,10 @@ void Glulxe::finalize_vm() {
 		glulx_free(stack);
 		stack = nullptr;
 	}
+	if (instrcache) {
+		glulx_free(instrcache);
+		instrcache = nullptr;
+	}
 
 	final_serial();
 }
@@ -72,6 +72,7 @@ MODULE_OBJS := \
 	glulxe/glkop.o \
 	glulxe/glulxe.o \
 	glulxe/heap.o \
+	glulxe/profile.o \
 	glulxe/operand.o \
 	glulxe/search.o \
 	glulxe/serial.o \
@@ -128,6 +128,16 @@ public:
 	 * @returns         Width of string multiplied by GLI_SUBPIX
 	 */
 	size_t stringWidthUni(int fontIdx, const Common::U32String &text, int spw = 0);
+
+	/**
+	 * Get the width in pixels a unicode character adds to a string
+	 * @param fontIdx   Which font to use
+	 * @param prev      The preceding character, or 0 at the start of the string
+	 * @param ch        Character to get the width of
+	 * @returns         Width of the character, including kerning against the
+	 *                  preceding character, multiplied by GLI_SUBPIX
+	 */
+	int charWidthUni(int fontIdx, uint32 prev, uint32 ch);
 };
 
 } // End of namespace Glk
@@ -40,7 +40,7 @@ TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : Window(windows
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
 		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
-		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
+		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _lineWidth(0), _lineWidthLen(0), _spaced(0), _dashed(0),
 		_copyBuf(0), _copyPos(0) {
 	_type = wintype_TextBuffer;
 	_history.resize(HISTORYLEN);
@@ -235,7 +235,10 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Lines are only ever skipped by redraw when not scrolled back, so only
+	// the ones currently on screen need to be marked
+	int lastLine = MIN(_scrollMax, _scrollPos + _height);
+	for (int i = 0; i < lastLine; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -319,6 +322,7 @@ void TextBufferWindow::putText(const char *buf, int len, int pos, int oldlen) {
 		}
 	}
 	_numChars += diff;
+	resetLineWidth();
 
 	if (_inBuf) {
 		if (_inCurs >= pos + oldlen)
@@ -351,6 +355,7 @@ void TextBufferWindow::putTextUni(const uint32 *buf, int len, int pos, int oldle
 			_attrs[pos + i].set(style_Input);
 	}
 	_numChars += diff;
+	resetLineWidth();
 
 	if (_inBuf) {
 		if (_inCurs >= pos + oldlen)
@@ -426,6 +431,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			_dashed++;
 			if (_dashed == 2) {
 				_numChars--;
+				resetLineWidth();
 				if (_font._dashes == 2)
 					ch = UNI_NDASH;
 				else
@@ -433,6 +439,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			}
 			if (_dashed == 3) {
 				_numChars--;
+				resetLineWidth();
 				ch = UNI_MDASH;
 				_dashed = 0;
 			}
@@ -484,7 +491,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			&& !_styles[_attrs[linelen - 1].style].reverse)
 		linelen--;
 
-	if (calcWidth(_chars, _attrs, 0, linelen, -1) >= pw) {
+	if (lineWidth(linelen) >= pw) {
 		bpoint = _numChars;
 
 		for (i = _numChars - 1; i > 0; i--) {
@@ -505,6 +512,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 		memcpy(_chars, bchars, saved * 4);
 		memcpy(_attrs, battrs, saved * sizeof(Attributes));
 		_numChars = saved;
+		resetLineWidth();
 	}
 
 	touch(0);
@@ -513,6 +521,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 bool TextBufferWindow::unputCharUni(uint32 ch) {
 	if (_numChars > 0 && _chars[_numChars - 1] == ch) {
 		_numChars--;
+		resetLineWidth();
 		touch(0);
 		return true;
 	}
@@ -536,6 +545,7 @@ void TextBufferWindow::clear() {
 	_dashed = 0;
 
 	_numChars = 0;
+	resetLineWidth();
 
 	for (i = 0; i < _scrollBack; i++) {
 		_lines[i]._len = 0;
@@ -793,6 +803,7 @@ void TextBufferWindow::cancelLineEvent(Event *ev) {
 		putCharUni('\n');
 	} else {
 		_numChars = _inFence;
+		resetLineWidth();
 		touch(0);
 	}
 
@@ -814,6 +825,7 @@ void TextBufferWindow::redraw() {
 	int selrow, selchar, sx0, sx1, selleft, selright;
 	bool selBuf;
 	int tx, tsc, tsw, lsc, rsc;
+	TextBufferRow selLine;
 	Screen &screen = *g_vm->_screen;
 
 	Window::redraw();
@@ -849,7 +861,10 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
+		// selected characters get reversed while drawing, so draw those lines from a copy
+		if (selrow)
+			selLine = _lines[i];
+		TextBufferRow &ln = selrow ? selLine : _lines[i];
 
 		// skip if we can
 		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
@@ -882,8 +897,11 @@ void TextBufferWindow::redraw() {
 			linelen --;
 
 		// kill characters that would overwrite the scroll bar
-		while (linelen > 1 && calcWidth(ln._chars, ln._attrs, 0, linelen, -1) >= pw)
+		w = calcWidth(ln._chars, ln._attrs, 0, linelen, -1);
+		while (linelen > 1 && w >= pw) {
 			linelen --;
+			w -= charWidth(ln._chars, ln._attrs, 0, linelen);
+		}
 
 		/*
 		 * count spaces and width for justification
@@ -1080,7 +1098,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1481,6 +1499,7 @@ void TextBufferWindow::acceptLine(uint32 keycode) {
 		putCharUni('\n');
 	} else {
 		_numChars = _inFence;
+		resetLineWidth();
 		touch(0);
 	}
 
@@ -1540,11 +1559,10 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// The oldest row is never in use, so it gets recycled as the new line
+	_lines.rotate();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
 
 	if (_radjn)
 		_radjn--;
@@ -1564,11 +1582,13 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._rPic = nullptr;
 	_lines[0]._lHyper = 0;
 	_lines[0]._rHyper = 0;
-	
+	_lines[0]._repaint = false;
+
 	Common::fill(_chars, _chars + TBLINELEN, ' ');
 	memset(_attrs, 0, TBLINELEN * sizeof(Attributes));
 
 	_numChars = 0;
+	resetLineWidth();
 
 	touchScroll();
 
@@ -1577,7 +1597,6 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 void TextBufferWindow::scrollResize() {
 	int i;
 
-	_lines.clear();
 	_lines.resize(_scrollBack + SCROLLBACK);
 
 	_chars = _lines[0]._chars;
@@ -1601,6 +1620,22 @@ void TextBufferWindow::scrollResize() {
 	_scrollBack += SCROLLBACK;
 }
 
+int TextBufferWindow::charWidth(const uint32 *chars, const Attributes *attrs, int startchar, int idx) {
+	// Kerning only applies within a run of characters drawn with the same attributes
+	uint32 prev = (idx > startchar && attrs[idx - 1] == attrs[idx]) ? chars[idx - 1] : 0;
+	return g_vm->_screen->charWidthUni(attrs[idx].attrFont(_styles), prev, chars[idx]);
+}
+
+int TextBufferWindow::lineWidth(int linelen) {
+	if (_lineWidthLen > linelen)
+		resetLineWidth();
+
+	for (; _lineWidthLen < linelen; _lineWidthLen++)
+		_lineWidth += charWidth(_chars, _attrs, 0, _lineWidthLen);
+
+	return _lineWidth;
+}
+
 int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numChars, int spw) {
 	Screen &screen = *g_vm->_screen;
 	int w = 0;
@@ -1640,4 +1675,20 @@ TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(
 	Common::fill(&_chars[0], &_chars[TBLINELEN], 0);
 }
 
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_head == 0) {
+		_rows.resize(newSize);
+		return;
+	}
+
+	// Unroll the ring so that row 0 is back at the start of the array
+	Common::Array<TextBufferRow> rows;
+	rows.resize(newSize);
+	for (uint i = 0; i < _rows.size() && i < newSize; i++)
+		rows[i] = (*this)[i];
+
+	_rows = rows;
+	_head = 0;
+}
+
 } // End of namespace Glk
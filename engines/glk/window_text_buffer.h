@@ -53,7 +53,40 @@ class TextBufferWindow : public Window, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * The scrollback rows, with row 0 being the line currently being written.
+	 * The rows are kept in a ring, so scrolling in a new line only has to
+	 * rotate it rather than moving the whole scrollback down a row
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _head;
+	public:
+		TextBufferRows() : _head(0) {}
+
+		TextBufferRow &operator[](int idx) {
+			return _rows[(_head + idx) % _rows.size()];
+		}
+		const TextBufferRow &operator[](int idx) const {
+			return _rows[(_head + idx) % _rows.size()];
+		}
+
+		uint size() const { return _rows.size(); }
+
+		/**
+		 * Resize the scrollback, keeping the existing rows in order
+		 */
+		void resize(uint newSize);
+
+		/**
+		 * Moves every row down by one, turning the oldest row into row 0
+		 */
+		void rotate() {
+			_head = (_head + _rows.size() - 1) % _rows.size();
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
@@ -92,6 +125,26 @@ private:
 	void scrollOneLine(bool forced);
 	void scrollResize();
 	int calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numchars, int spw);
+
+	/**
+	 * Returns the width the given character adds to a string measured from
+	 * startchar, so that summing it over a range matches calcWidth
+	 */
+	int charWidth(const uint32 *chars, const Attributes *attrs, int startchar, int idx);
+
+	/**
+	 * Returns the width of the first linelen characters of the current line,
+	 * only measuring the characters added since the last call
+	 */
+	int lineWidth(int linelen);
+
+	/**
+	 * Forget the cached width of the current line. Must be called whenever
+	 * characters already in the line are changed or removed
+	 */
+	void resetLineWidth() {
+		_lineWidth = _lineWidthLen = 0;
+	}
 public:
 	int _width, _height;
 	int _spaced;
@@ -103,6 +156,8 @@ public:
 	int _numChars;        ///< number of chars in last line: lines[0]
 	uint32 *_chars;       ///< alias to lines[0].chars
 	Attributes *_attrs;   ///< alias to lines[0].attrs
+	int _lineWidth;       ///< cached width of the first lineWidthLen chars of lines[0]
+	int _lineWidthLen;
 
 	///< adjust margins temporarily for images
 	int _ladjw;
@@ -1694,6 +1694,16 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		return;
 	}
 
+	// Unscaled shapes without any color effects are by far the most common
+	// case. Their lines are copied a run of opaque pixels at a time instead
+	// of calling the plotting method for every single pixel.
+	if (!(flags & DSF_SCALE) && dsPlot2 == &Screen::drawShapePlotType0 && dsPlot3 == &Screen::drawShapePlotType0) {
+		if (flags & DSF_X_FLIPPED)
+			_dsProcessLine = &Screen::drawShapeCopyLineNoScale<false>;
+		else
+			_dsProcessLine = &Screen::drawShapeCopyLineNoScale<true>;
+	}
+
 	int curY = y;
 	const uint8 *src = shapeData;
 	uint8 *dst = _dsDstPage = getPagePtr(pageNum);
@@ -2031,6 +2041,37 @@ void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src,
 	} while (cnt > 0);
 }
 
+template<bool upwind>
+void Screen::drawShapeCopyLineNoScale(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
+	do {
+		if (*src) {
+			// Every non zero byte is a pixel, so the run ends at the next
+			// zero byte or at the end of the visible part of the line.
+			const uint8 *runEnd = (const uint8 *)memchr(src, 0, cnt);
+			int len = runEnd ? runEnd - src : cnt;
+
+			if (upwind) {
+				memcpy(dst, src, len);
+				dst += len;
+			} else {
+				for (int i = 0; i < len; ++i)
+					*dst-- = src[i];
+			}
+
+			src += len;
+			cnt -= len;
+		} else {
+			uint8 c = src[1];
+			src += 2;
+			if (upwind)
+				dst += c;
+			else
+				dst -= c;
+			cnt -= c;
+		}
+	} while (cnt > 0);
+}
+
 void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -26,6 +26,7 @@
 #include "kyra/engine/timer.h"
 #include "kyra/resource/resource.h"
 #include "kyra/engine/lol.h"
+#include "kyra/graphics/screen_lol.h"
 #include "kyra/engine/eobcommon.h"
 
 #include "common/system.h"
@@ -472,6 +473,72 @@ bool Debugger_HoF::cmdPasscodes(int argc, const char **argv) {
 
 #ifdef ENABLE_LOL
 Debugger_LoL::Debugger_LoL(LoLEngine *vm) : Debugger(vm), _vm(vm) {
+	registerCmd("shape_benchmark",    WRAP_METHOD(Debugger_LoL, cmdShapeBenchmark));
+}
+
+bool Debugger_LoL::cmdShapeBenchmark(int argc, const char **argv) {
+	int passes = (argc > 1) ? atoi(argv[1]) : 100;
+	if (passes < 1) {
+		debugPrintf("Syntax: shape_benchmark [<passes>]\n");
+		return true;
+	}
+
+	struct ShapeSet {
+		uint8 **shapes;
+		int num;
+	} const sets[] = {
+		{ _vm->_gameShapes, _vm->_numGameShapes },
+		{ _vm->_itemIconShapes, _vm->_numItemIconShapes },
+		{ _vm->_itemShapes, _vm->_numItemShapes },
+		{ _vm->_thrownShapes, _vm->_numThrownShapes },
+		{ _vm->_effectShapes, _vm->_numEffectShapes },
+		{ _vm->_fireballShapes, _vm->_numFireballShapes },
+		{ _vm->_healShapes, _vm->_numHealShapes },
+		{ _vm->_healiShapes, _vm->_numHealiShapes },
+		{ _vm->_monsterShapes, 48 }
+	};
+
+	Screen_LoL *screen = _vm->_screen;
+	const int page = 2;
+
+	// Draw onto a page which is not visible and restore it afterwards
+	uint8 *backup = new uint8[320 * 200];
+	screen->copyRegionToBuffer(page, 0, 0, 320, 200, backup);
+
+	int numShapes = 0;
+	uint32 unscaledTime = 0, scaledTime = 0;
+
+	for (int scaled = 0; scaled < 2; ++scaled) {
+		const uint32 start = g_system->getMillis();
+		for (int pass = 0; pass < passes; ++pass) {
+			numShapes = 0;
+			for (uint i = 0; i < ARRAYSIZE(sets); ++i) {
+				if (!sets[i].shapes)
+					continue;
+				for (int ii = 0; ii < sets[i].num; ++ii) {
+					const uint8 *shp = sets[i].shapes[ii];
+					if (!shp)
+						continue;
+					const int flip = (ii & 1) ? Screen::DSF_X_FLIPPED : 0;
+					if (scaled)
+						screen->drawShape(page, shp, 80, 50, 0, flip | Screen::DSF_SCALE, 0xC0, 0xC0);
+					else
+						screen->drawShape(page, shp, 80, 50, 0, flip);
+					++numShapes;
+				}
+			}
+		}
+		if (scaled)
+			scaledTime = g_system->getMillis() - start;
+		else
+			unscaledTime = g_system->getMillis() - start;
+	}
+
+	screen->copyBlockToPage(page, 0, 0, 320, 200, backup);
+	delete[] backup;
+
+	debugPrintf("Drew %d shapes %d times: %d ms unscaled, %d ms scaled\n", numShapes, passes, unscaledTime, scaledTime);
+	return true;
 }
 #endif // ENABLE_LOL
 
@@ -105,6 +105,8 @@ public:
 
 protected:
 	LoLEngine *_vm;
+
+	bool cmdShapeBenchmark(int argc, const char **argv);
 };
 #endif // ENABLE_LOL
 
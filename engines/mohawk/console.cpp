@@ -313,6 +313,10 @@ bool MystConsole::Cmd_Cache(int argc, const char **argv) {
 	}
 
 	debugPrintf("Cache: %s\n", state ? "Enabled" : "Disabled");
+
+	const ResourceCache &cache = _vm->getResourceCache();
+	debugPrintf("Resources: %d, %d / %d KB\n", cache.getCount(), cache.getSize() / 1024, cache.getBudget() / 1024);
+	debugPrintf("Images: %d KB\n", _vm->_gfx->getCacheSize() / 1024);
 	return true;
 }
 
@@ -68,7 +68,9 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() :
+		_cacheSize(0),
+		_cacheUseCounter(0) {
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -76,8 +78,8 @@ GraphicsManager::~GraphicsManager() {
 }
 
 void GraphicsManager::clearCache() {
-	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++)
-		delete it->_value;
+	for (Common::HashMap<uint16, CachedImage>::iterator it = _cache.begin(); it != _cache.end(); it++)
+		delete it->_value.surface;
 	for (Common::HashMap<uint16, Common::Array<MohawkSurface *> >::iterator it = _subImageCache.begin(); it != _subImageCache.end(); it++) {
 		Common::Array<MohawkSurface *> &array = it->_value;
 		for (uint i = 0; i < array.size(); i++)
@@ -86,18 +88,50 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_cacheSize = 0;
 }
 
-MohawkSurface *GraphicsManager::findImage(uint16 id) {
-	if (!_cache.contains(id))
-		_cache[id] = decodeImage(id);
+void GraphicsManager::trimCache() {
+	while (_cacheSize > kImageCacheBudget) {
+		Common::HashMap<uint16, CachedImage>::iterator oldest = _cache.end();
+		for (Common::HashMap<uint16, CachedImage>::iterator it = _cache.begin(); it != _cache.end(); it++)
+			if (!it->_value.pinned && (oldest == _cache.end() || it->_value.lastUse < oldest->_value.lastUse))
+				oldest = it;
+
+		if (oldest == _cache.end())
+			break;
+
+		_cacheSize -= oldest->_value.size;
+		delete oldest->_value.surface;
+		_cache.erase(oldest);
+	}
+}
+
+void GraphicsManager::cacheImage(uint16 id, MohawkSurface *surface, bool pinned) {
+	const Graphics::Surface *s = surface->getSurface();
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	CachedImage image;
+	image.surface = surface;
+	image.size = s ? s->pitch * s->h : 0;
+	image.lastUse = ++_cacheUseCounter;
+	image.pinned = pinned;
 
-	return _cache[id];
+	_cache[id] = image;
+	_cacheSize += image.size;
+}
+
+MohawkSurface *GraphicsManager::findImage(uint16 id) {
+	Common::HashMap<uint16, CachedImage>::iterator it = _cache.find(id);
+	if (it != _cache.end()) {
+		it->_value.lastUse = ++_cacheUseCounter;
+		return it->_value.surface;
+	}
+
+	// The cache is only trimmed down to its budget by trimCache(), so that
+	// the surfaces handed out here stay valid until the next card change.
+	MohawkSurface *surface = decodeImage(id);
+	cacheImage(id, surface, false);
+	return surface;
 }
 
 Common::Array<MohawkSurface *> GraphicsManager::decodeImages(uint16 id) {
@@ -224,10 +258,18 @@ void GraphicsManager::copyAnimImageSectionToScreen(MohawkSurface *image, Common:
 }
 
 void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
-	if (_cache.contains(id))
-		error("Image %d already in cache", id);
+	Common::HashMap<uint16, CachedImage>::iterator it = _cache.find(id);
+	if (it != _cache.end()) {
+		if (it->_value.pinned)
+			error("Image %d already in cache", id);
+
+		// Replace the image decoded for an earlier card
+		_cacheSize -= it->_value.size;
+		delete it->_value.surface;
+		_cache.erase(it);
+	}
 
-	_cache[id] = surface;
+	cacheImage(id, surface, true);
 }
 
 } // End of namespace Mohawk
@@ -74,6 +74,14 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// Free the least recently used surfaces until the cache fits its budget.
+	// Images added with addImageToCache are kept until clearCache is called.
+	// Surfaces returned by findImage may be freed, so only call this
+	// when no such pointers are held, like on card changes.
+	void trimCache();
+
+	uint32 getCacheSize() const { return _cacheSize; }
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -97,8 +105,23 @@ protected:
 	void addImageToCache(uint16 id, MohawkSurface *surface);
 
 private:
-	// An image cache that stores images until clearCache() is called
-	Common::HashMap<uint16, MohawkSurface *> _cache;
+	enum {
+		kImageCacheBudget = 32 * 1024 * 1024
+	};
+
+	struct CachedImage {
+		MohawkSurface *surface;
+		uint32 size;
+		uint32 lastUse;
+		bool pinned;
+	};
+
+	void cacheImage(uint16 id, MohawkSurface *surface, bool pinned);
+
+	// An image cache that stores images until trimCache() or clearCache() is called
+	Common::HashMap<uint16, CachedImage> _cache;
+	uint32 _cacheSize;
+	uint32 _cacheUseCounter;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
 };
 
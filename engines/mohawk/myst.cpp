@@ -130,7 +130,7 @@ Common::Array<uint16> MohawkEngine_Myst::getResourceIDList(uint32 type) const {
 }
 
 void MohawkEngine_Myst::cachePreload(uint32 tag, uint16 id) {
-	if (!_cache.enabled)
+	if (!_cache.enabled || _cache.contains(tag, id))
 		return;
 
 	for (uint32 i = 0; i < _mhk.size(); i++) {
@@ -158,6 +158,23 @@ void MohawkEngine_Myst::cachePreload(uint32 tag, uint16 id) {
 	debugC(kDebugCache, "cachePreload: Could not find a \'%s\' resource with ID %04x", tag2str(tag), id);
 }
 
+void MohawkEngine_Myst::prefetchCard(uint16 id) {
+	if (!hasResource(ID_VIEW, id))
+		return;
+
+	uint16 image = MystCard::peekBackgroundImageId(this, id);
+	if (!image)
+		return;
+
+	if (!hasResource(ID_WDIB, image) && !((getFeatures() & GF_ME) && hasResource(ID_PICT, image)))
+		return;
+
+	debugC(kDebugCache, "Prefetching image %d of card %d", image, id);
+
+	// Decoding the image also brings the raw resource in the resource cache
+	_gfx->preloadImage(image);
+}
+
 static const char *mystFiles[] = {
 	"channel",
 	"credits",
@@ -559,6 +576,13 @@ void MohawkEngine_Myst::doFrame() {
 		refreshCursor();
 
 		_mouseMoved = false;
+
+		// Prefetch at most one card per frame to keep the input responsive
+		if (!_mouseClicked && !_prefetchCards.empty() && _card == card) {
+			uint16 nextCard = _prefetchCards.back();
+			_prefetchCards.pop_back();
+			prefetchCard(nextCard);
+		}
 	}
 
 	_system->updateScreen();
@@ -740,6 +764,7 @@ void MohawkEngine_Myst::changeToStack(MystStack stackId, uint16 card, uint16 lin
 	// Clear the resource cache and the image cache
 	_cache.clear();
 	_gfx->clearCache();
+	_prefetchCards.clear();
 
 	changeToCard(card, kTransitionCopy);
 
@@ -754,9 +779,10 @@ void MohawkEngine_Myst::changeToCard(uint16 card, TransitionType transition) {
 
 	_video->stopVideos();
 
-	// Clear the resource cache and image cache
-	_cache.clear();
-	_gfx->clearCache();
+	// Resource ids are unique within a stack, so the cached resources and
+	// images can be kept for the next cards. Only keep the cache within budget.
+	_gfx->trimCache();
+	_prefetchCards.clear();
 
 	_mouseClicked = false;
 	_mouseMoved = false;
@@ -769,6 +795,10 @@ void MohawkEngine_Myst::changeToCard(uint16 card, TransitionType transition) {
 	_card = MystCardPtr(new MystCard(this, card));
 	_card->enter();
 
+	// The images of the cards the player can move to next are decoded while idle
+	if (_cache.enabled)
+		_prefetchCards = _card->getDestinationCards();
+
 	// The demo resets the cursor at each card change except when in the library
 	if (getFeatures() & GF_DEMO
 			&& _gameState->_globals.currentAge != kMystLibrary) {
@@ -1101,6 +1131,7 @@ void MohawkEngine_Myst::goToMainMenu() {
 	// Clear the resource cache and the image cache
 	_cache.clear();
 	_gfx->clearCache();
+	_prefetchCards.clear();
 
 	_card = MystCardPtr(new MystCard(this, 1000));
 	_card->enter();
@@ -1119,6 +1150,7 @@ void MohawkEngine_Myst::resumeFromMainMenu() {
 	// Clear the resource cache and image cache
 	_cache.clear();
 	_gfx->clearCache();
+	_prefetchCards.clear();
 
 	_mouseClicked = false;
 	_mouseMoved = false;
@@ -136,6 +136,7 @@ public:
 	Common::SeekableReadStream *getResource(uint32 tag, uint16 id) override;
 	Common::Array<uint16> getResourceIDList(uint32 type) const;
 	void cachePreload(uint32 tag, uint16 id);
+	void prefetchCard(uint16 id);
 
 	void changeToStack(MystStack stackId, uint16 card, uint16 linkSrcSound, uint16 linkDstSound);
 	void changeToCard(uint16 card, TransitionType transition);
@@ -166,6 +167,7 @@ public:
 
 	void setCacheState(bool state) { _cache.enabled = state; }
 	bool getCacheState() { return _cache.enabled; }
+	const ResourceCache &getResourceCache() const { return _cache; }
 
 	VideoEntryPtr playMovie(const Common::String &name, MystStack stack);
 	VideoEntryPtr playMovieFullscreen(const Common::String &name, MystStack stack);
@@ -204,6 +206,9 @@ private:
 	MystOptionsDialog *_optionsDialog;
 	ResourceCache _cache;
 
+	/** Cards reachable from the current card whose images are yet to be prefetched */
+	Common::Array<uint16> _prefetchCards;
+
 	MystScriptParserPtr _prevStack;
 
 	MystCardPtr _card;
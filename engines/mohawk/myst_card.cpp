@@ -74,6 +74,61 @@ uint16 MystCard::getId() const {
 	return _id;
 }
 
+Common::Array<uint16> MystCard::getDestinationCards() {
+	Common::Array<uint16> cards;
+
+	for (uint16 i = 0; i < _resources.size(); i++) {
+		MystArea *resource = _resources[i];
+		bool isNavigation = resource->hasType(kMystAreaForward) || resource->hasType(kMystAreaLeft)
+				|| resource->hasType(kMystAreaRight) || resource->hasType(kMystAreaDown)
+				|| resource->hasType(kMystAreaUp);
+		if (!isNavigation || !resource->isEnabled())
+			continue;
+
+		uint16 dest = resource->getDest();
+		if (!dest || dest == _id)
+			continue;
+
+		bool duplicate = false;
+		for (uint j = 0; j < cards.size(); j++)
+			if (cards[j] == dest)
+				duplicate = true;
+
+		if (!duplicate)
+			cards.push_back(dest);
+	}
+
+	return cards;
+}
+
+uint16 MystCard::peekBackgroundImageId(MohawkEngine_Myst *vm, uint16 id) {
+	Common::SeekableReadStream *viewStream = vm->getResource(ID_VIEW, id);
+
+	// Same logic as loadView() followed by getBackgroundImageId()
+	viewStream->readUint16LE(); // flags
+
+	uint16 imageToDraw = 0;
+	uint16 conditionalImageCount = viewStream->readUint16LE();
+	if (conditionalImageCount != 0) {
+		for (uint16 i = 0; i < conditionalImageCount; i++) {
+			uint16 var = viewStream->readUint16LE();
+			uint16 numStates = viewStream->readUint16LE();
+			uint16 varValue = vm->_stack->getVar(var);
+
+			for (uint16 j = 0; j < numStates; j++) {
+				uint16 value = viewStream->readUint16LE();
+				if (j == varValue)
+					imageToDraw = value;
+			}
+		}
+	} else {
+		imageToDraw = viewStream->readUint16LE();
+	}
+
+	delete viewStream;
+	return imageToDraw;
+}
+
 void MystCard::loadView() {
 	debugC(kDebugView, "Loading Card View: %d", _id);
 
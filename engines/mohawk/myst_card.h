@@ -51,6 +51,15 @@ public:
 	/** Run the card's leave scripts */
 	void leave();
 
+	/** Get the ids of the cards the enabled navigation areas lead to */
+	Common::Array<uint16> getDestinationCards();
+
+	/**
+	 * Get the id of the image a card would be drawn with in the current game state,
+	 * without loading the card. Returns 0 if the card has no background image.
+	 */
+	static uint16 peekBackgroundImageId(MohawkEngine_Myst *vm, uint16 id);
+
 	/** Get a card resource (hotspot) by its index in the resource list */
 	template<class T>
 	T *getResource(uint index);
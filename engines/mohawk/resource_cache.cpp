@@ -21,12 +21,16 @@
  */
 
 #include "common/debug.h"
+#include "common/memstream.h"
 #include "mohawk/myst.h"
 #include "mohawk/resource_cache.h"
 
 namespace Mohawk {
 
-ResourceCache::ResourceCache() {
+ResourceCache::ResourceCache(uint32 budget) :
+		_size(0),
+		_budget(budget),
+		_useCounter(0) {
 	enabled = true;
 }
 
@@ -35,30 +39,66 @@ ResourceCache::~ResourceCache() {
 }
 
 void ResourceCache::clear() {
-	if (!enabled)
-		return;
-
 	debugC(kDebugCache, "Clearing Cache...");
 
-	for (uint32 i = 0; i < _store.size(); i++)
-		delete _store[i].data;
+	for (DataMap::iterator it = _store.begin(); it != _store.end(); it++)
+		free(it->_value.data);
 
 	_store.clear();
+	_size = 0;
+}
+
+void ResourceCache::evict(uint32 needed) {
+	while (!_store.empty() && _size + needed > _budget) {
+		DataMap::iterator oldest = _store.begin();
+		for (DataMap::iterator it = _store.begin(); it != _store.end(); it++)
+			if (it->_value.lastUse < oldest->_value.lastUse)
+				oldest = it;
+
+		debugC(kDebugCache, "Evicting tag 0x%04X id %d (%d bytes)", oldest->_key.tag, oldest->_key.id, oldest->_value.size);
+
+		_size -= oldest->_value.size;
+		free(oldest->_value.data);
+		_store.erase(oldest);
+	}
 }
 
 void ResourceCache::add(uint32 tag, uint16 id, Common::SeekableReadStream *data) {
 	if (!enabled)
 		return;
 
+	DataKey key(tag, id);
+	if (_store.contains(key))
+		return;
+
+	uint32 size = data->size();
+
+	// Large resources, such as long sounds, would flush everything else
+	if (size > _budget / 4) {
+		debugC(kDebugCache, "Not caching tag 0x%04X id %d, %d bytes is too large", tag, id, size);
+		return;
+	}
+
+	evict(size);
+
 	debugC(kDebugCache, "Adding item %d - tag 0x%04X id %d", _store.size(), tag, id);
 
 	DataObject current;
-	current.tag = tag;
-	current.id = id;
+	current.data = (byte *)malloc(MAX<uint32>(size, 1));
+	current.size = size;
+	current.lastUse = ++_useCounter;
+
 	uint32 dataCurPos = data->pos();
-	current.data = data->readStream(data->size());
+	data->seek(0);
+	data->read(current.data, size);
 	data->seek(dataCurPos);
-	_store.push_back(current);
+
+	_store[key] = current;
+	_size += size;
+}
+
+bool ResourceCache::contains(uint32 tag, uint16 id) const {
+	return enabled && _store.contains(DataKey(tag, id));
 }
 
 // Returns NULL if not found
@@ -68,18 +108,20 @@ Common::SeekableReadStream *ResourceCache::search(uint32 tag, uint16 id) {
 
 	debugC(kDebugCache, "Searching for tag 0x%04X id %d", tag, id);
 
-	for (uint32 i = 0; i < _store.size(); i++) {
-		if (tag == _store[i].tag && id == _store[i].id) {
-			debugC(kDebugCache, "Found cached tag 0x%04X id %u", tag, id);
-			uint32 dataCurPos  = _store[i].data->pos();
-			Common::SeekableReadStream *ret = _store[i].data->readStream(_store[i].data->size());
-			_store[i].data->seek(dataCurPos);
-			return ret;
-		}
+	DataMap::iterator it = _store.find(DataKey(tag, id));
+	if (it == _store.end()) {
+		debugC(kDebugCache, "tag 0x%04X id %d not found", tag, id);
+		return nullptr;
 	}
 
-	debugC(kDebugCache, "tag 0x%04X id %d not found", tag, id);
-	return nullptr;
+	debugC(kDebugCache, "Found cached tag 0x%04X id %u", tag, id);
+	DataObject &object = it->_value;
+	object.lastUse = ++_useCounter;
+
+	// Hand out a copy, callers own and delete the returned stream
+	byte *copy = (byte *)malloc(MAX<uint32>(object.size, 1));
+	memcpy(copy, object.data, object.size);
+	return new Common::MemoryReadStream(copy, object.size, DisposeAfterUse::YES);
 }
 
 } // End of namespace Mohawk
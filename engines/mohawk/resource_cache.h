@@ -23,32 +23,69 @@
 #ifndef RESOURCE_CACHE_H
 #define RESOURCE_CACHE_H
 
-#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/stream.h"
 
 namespace Mohawk {
 
+/**
+ * Keeps copies of recently read resources in memory.
+ *
+ * Entries are indexed by tag and id. The total size of the cached data is
+ * kept below a budget by evicting the least recently used entries.
+ */
 class ResourceCache {
 public:
-	ResourceCache();
+	ResourceCache(uint32 budget = kDefaultBudget);
 	~ResourceCache();
 
 	bool enabled;
 
 	void clear();
 	void add(uint32 tag, uint16 id, Common::SeekableReadStream *data);
+	bool contains(uint32 tag, uint16 id) const;
 
 	// Returns NULL if not found
 	Common::SeekableReadStream *search(uint32 tag, uint16 id);
 
+	uint32 getSize() const { return _size; }
+	uint32 getBudget() const { return _budget; }
+	uint32 getCount() const { return _store.size(); }
+
 private:
-	struct DataObject {
+	enum {
+		kDefaultBudget = 16 * 1024 * 1024
+	};
+
+	struct DataKey {
 		uint32 tag;
 		uint16 id;
-		Common::SeekableReadStream *data;
+
+		DataKey(uint32 t, uint16 i) : tag(t), id(i) {}
+	};
+
+	struct DataKey_Hash {
+		uint operator()(const DataKey &x) const { return x.tag ^ (x.id << 16) ^ x.id; }
+	};
+
+	struct DataKey_EqualTo {
+		bool operator()(const DataKey &x, const DataKey &y) const { return x.tag == y.tag && x.id == y.id; }
+	};
+
+	struct DataObject {
+		byte *data;
+		uint32 size;
+		uint32 lastUse;
 	};
 
-	Common::Array<DataObject> _store;
+	typedef Common::HashMap<DataKey, DataObject, DataKey_Hash, DataKey_EqualTo> DataMap;
+
+	void evict(uint32 needed);
+
+	DataMap _store;
+	uint32 _size;
+	uint32 _budget;
+	uint32 _useCounter;
 };
 
 } // End of namespace Mohawk
@@ -602,9 +602,9 @@ static const RivenSpecialChange rivenSpecialChange[] = {
 void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	debug (1, "Changing to card %d", dest);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
+	// Images are often shared between neighbouring cards of a stack, so only
+	// drop the least recently used ones once the cache goes over budget.
+	_gfx->trimCache();
 
 	if (!(getFeatures() & GF_DEMO)) {
 		for (byte i = 0; i < ARRAYSIZE(rivenSpecialChange); i++)
@@ -117,10 +117,14 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Index into the visibility cache, -1 if not cached
+	int cacheId;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		cacheId = -1;
 	}
 };
 
@@ -263,6 +267,11 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
+	// Cached visibility between the vertices with a cacheId, owned by the
+	// engine state
+	byte *_visibility;
+	int _visibilitySize;
+
 	PathfindingState(int width, int height) : _width(width), _height(height) {
 		vertex_start = NULL;
 		vertex_end = NULL;
@@ -270,6 +279,8 @@ struct PathfindingState {
 		_prependPoint = NULL;
 		_appendPoint = NULL;
 		vertices = 0;
+		_visibility = NULL;
+		_visibilitySize = 0;
 	}
 
 	~PathfindingState() {
@@ -699,6 +710,46 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+// Visibility cache entries
+enum {
+	VIS_UNKNOWN = 0,
+	VIS_VISIBLE = 1,
+	VIS_HIDDEN = 2
+};
+
+/**
+ * Determines whether a vertex can be seen from another one.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if vertex is visible from vertex_cur
+ */
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -708,33 +759,27 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
 
+	byte *cacheRow = NULL;
+	if (s->_visibility && vertex_cur->cacheId >= 0)
+		cacheRow = s->_visibility + vertex_cur->cacheId * s->_visibilitySize;
+
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		if (vertex == vertex_cur)
 			continue;
 
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
-
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
+		bool visible;
+		if (cacheRow && vertex->cacheId >= 0) {
+			byte &cached = cacheRow[vertex->cacheId];
+			if (cached == VIS_UNKNOWN)
+				cached = is_visible(s, vertex_cur, vertex) ? VIS_VISIBLE : VIS_HIDDEN;
+			visible = (cached == VIS_VISIBLE);
+		} else {
+			visible = is_visible(s, vertex_cur, vertex);
 		}
 
-		if (j == s->vertices)
+		if (visible)
 			visVerts->push_front(vertex);
 	}
 
@@ -1348,6 +1393,74 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	return pf_s;
 }
 
+/**
+ * Attaches the cached visibility graph of the polygon set to the pathfinding
+ * state, creating a new one if the polygon set has not been seen recently.
+ * The visibility between two vertices only depends on the polygons with
+ * edges. Start and end points that do not split an edge are single-vertex
+ * polygons, so their visibility is not cached, but computed every time.
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) p: The pathfinding state
+ * Returns   : (bool) true if the polygon set was found in the cache
+ */
+static bool attach_visibility_cache(EngineState *s, PathfindingState *p) {
+	const uint kMaxCachedSets = 4;
+	const uint kMaxCachedVertices = 512;
+
+	AvoidPathVisibility current;
+	for (PolygonList::iterator it = p->polygons.begin(); it != p->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		if (!VERTEX_HAS_EDGES(polygon->vertices.first()))
+			continue;
+
+		uint size = 0;
+		Vertex *vertex;
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->cacheId = current.points.size();
+			current.points.push_back(vertex->v);
+			size++;
+		}
+		current.polygonSizes.push_back(size);
+	}
+
+	const uint count = current.points.size();
+	if (count > kMaxCachedVertices) {
+		for (int i = 0; i < p->vertices; i++)
+			p->vertex_index[i]->cacheId = -1;
+		return false;
+	}
+
+	Common::List<AvoidPathVisibility> &cache = s->_avoidPathCache;
+	bool found = false;
+	Common::List<AvoidPathVisibility>::iterator it;
+	for (it = cache.begin(); it != cache.end(); ++it) {
+		if (it->points == current.points && it->polygonSizes == current.polygonSizes) {
+			found = true;
+			break;
+		}
+	}
+
+	if (found) {
+		// Move to the front, so that the least recently used set is dropped
+		if (it != cache.begin()) {
+			cache.push_front(*it);
+			cache.erase(it);
+		}
+	} else {
+		current.visible.resize(count * count);
+		if (count)
+			memset(&current.visible[0], VIS_UNKNOWN, count * count);
+		cache.push_front(current);
+		if (cache.size() > kMaxCachedSets)
+			cache.pop_back();
+	}
+
+	AvoidPathVisibility &entry = cache.front();
+	p->_visibility = count ? &entry.visible[0] : NULL;
+	p->_visibilitySize = count;
+	return found;
+}
+
 /**
  * Computes a shortest path from vertex_start to vertex_end. The caller can
  * construct the resulting path by following the path_prev links from
@@ -1607,6 +1720,7 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			}
 		}
 
+		const uint32 startTime = g_system->getMillis();
 		PathfindingState *p = convert_polygon_set(s, poly_list, start, end, width, height, opt);
 
 		if (!p) {
@@ -1624,10 +1738,16 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			return output;
 		}
 
+		const bool cached = attach_visibility_cache(s, p);
+
 		// Apply Dijkstra
 		AStar(p);
 
 		output = output_path(p, s);
+
+		debugC(kDebugLevelAvoidPath, "AvoidPath: %d vertices, %s visibility graph, took %d ms",
+		       p->vertices, cached ? "cached" : "new", g_system->getMillis() - startTime);
+
 		delete p;
 
 		// Memory is freed by explicit calls to Memory
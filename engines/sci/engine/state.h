@@ -98,6 +98,16 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Visibility between the vertices of a polygon set, kept across kAvoidPath
+ * calls as rooms usually query the same obstacles many times.
+ */
+struct AvoidPathVisibility {
+	Common::Array<Common::Point> points; ///< Vertices of all polygons with edges, in list order
+	Common::Array<uint> polygonSizes; ///< Number of vertices of each of these polygons
+	Common::Array<byte> visible; ///< points.size() squared entries, refer to kpathing.cpp
+};
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -192,6 +202,9 @@ public:
 
 	MessageState *_msgState;
 
+	/** Visibility graphs of the most recently used pathfinding polygon sets */
+	Common::List<AvoidPathVisibility> _avoidPathCache;
+
 	// MemorySegment provides access to a 256-byte block of memory that remains
 	// intact across restarts and restores
 	enum {
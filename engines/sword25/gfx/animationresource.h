@@ -80,6 +80,14 @@ public:
 		return _valid;
 	}
 
+	virtual uint getMemoryUsage() const {
+		// The frame images are bitmap resources of their own, and are accounted there
+		uint size = sizeof(*this) + _frames.size() * sizeof(Frame);
+		for (uint i = 0; i < _frames.size(); ++i)
+			size += _frames[i].fileName.size() + _frames[i].action.size();
+		return size;
+	}
+
 private:
 	bool _valid;
 
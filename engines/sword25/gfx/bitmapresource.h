@@ -192,6 +192,11 @@ public:
 		return _pImage->isSolid();
 	}
 
+	virtual uint getMemoryUsage() const {
+		// All images are decoded to 32-bit ARGB
+		return _pImage ? _pImage->getWidth() * _pImage->getHeight() * 4 : 0;
+	}
+
 private:
 	Image *_pImage;
 };
@@ -96,6 +96,11 @@ public:
 		return _bitmapFileName;
 	}
 
+	virtual uint getMemoryUsage() const {
+		// The character map is a bitmap resource of its own, and is accounted there
+		return sizeof(*this) + _bitmapFileName.size();
+	}
+
 private:
 	Kernel *_pKernel;
 	bool _valid;
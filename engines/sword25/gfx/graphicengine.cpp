@@ -41,6 +41,7 @@
 #include "sword25/gfx/image/renderedimage.h"
 #include "sword25/gfx/image/swimage.h"
 #include "sword25/gfx/image/vectorimage.h"
+#include "sword25/kernel/resmanager.h"
 #include "sword25/package/packagemanager.h"
 #include "sword25/kernel/inputpersistenceblock.h"
 #include "sword25/kernel/outputpersistenceblock.h"
@@ -61,6 +62,7 @@ enum {
 namespace Sword25 {
 
 static const uint FRAMETIME_SAMPLE_COUNT = 5;       // Frame duration is averaged over FRAMETIME_SAMPLE_COUNT frames
+static const uint32 PRECACHE_BUDGET = 8;            // Time in ms per frame spent on loading queued resources
 
 GraphicEngine::GraphicEngine(Kernel *pKernel) :
 	_width(0),
@@ -146,6 +148,9 @@ bool GraphicEngine::endFrame() {
 
 	g_system->updateScreen();
 
+	// Use the rest of the frame to load resources the scripts announced
+	Kernel::getInstance()->getResourceManager()->processPrecacheQueue(PRECACHE_BUDGET);
+
 	return true;
 }
 
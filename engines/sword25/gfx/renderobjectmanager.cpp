@@ -41,21 +41,31 @@
 #include "sword25/gfx/timedrenderobject.h"
 #include "sword25/gfx/rootrenderobject.h"
 
+#include "common/debug-channels.h"
 #include "common/system.h"
 
+#include "sword25/sword25.h"	// for kDebugRender
+
 namespace Sword25 {
 
 void RenderObjectQueue::add(RenderObject *renderObject) {
-	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
+	_list.push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
+	_items[renderObject] = &_list.back();
+}
+
+bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) const {
+	ItemMap::const_iterator it = _items.find(renderObjectQueueItem._renderObject);
+	if (it == _items.end())
+		return false;
+
+	const RenderObjectQueueItem &item = *it->_value;
+	return item._version == renderObjectQueueItem._version &&
+		item._bbox == renderObjectQueueItem._bbox;
 }
 
-bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) {
-	for (RenderObjectQueue::iterator it = begin(); it != end(); ++it)
-		if ((*it)._renderObject == renderObjectQueueItem._renderObject &&
-			(*it)._version == renderObjectQueueItem._version && 
-			(*it)._bbox == renderObjectQueueItem._bbox)
-			return true;
-	return false;
+void RenderObjectQueue::clear() {
+	_list.clear();
+	_items.clear(true);
 }
 
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
@@ -104,18 +114,35 @@ bool RenderObjectManager::render() {
 	_uta->clear();
 
 	// Add rectangles of objects which don't exist in this frame any more
-	for (RenderObjectQueue::iterator it = _prevQueue->begin(); it != _prevQueue->end(); ++it) {
+	for (RenderObjectQueue::const_iterator it = _prevQueue->begin(); it != _prevQueue->end(); ++it) {
 		if (!_currQueue->exists(*it))
 			_uta->addRect((*it)._bbox);
 	}
 
 	// Add rectangles of objects which are different from the previous frame
-	for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
+	for (RenderObjectQueue::const_iterator it = _currQueue->begin(); it != _currQueue->end(); ++it) {
 		if (!_prevQueue->exists(*it))
 			_uta->addRect((*it)._bbox);
 	}
 
 	RectangleList *updateRects = _uta->getRectangles();
+
+	if (DebugMan.isDebugChannelEnabled(kDebugRender)) {
+		const Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
+		uint redrawnPixels = 0;
+		for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt)
+			redrawnPixels += (*rectIt).width() * (*rectIt).height();
+		debugC(kDebugRender, "Redrawing %d rects, %d%% of the screen, %d objects",
+		       updateRects->size(), redrawnPixels * 100 / (backSurface->w * backSurface->h), _currQueue->size());
+	}
+
+	// Nothing has changed since the last frame
+	if (updateRects->empty()) {
+		delete updateRects;
+		SWAP(_currQueue, _prevQueue);
+		return true;
+	}
+
 	Common::Array<int> updateRectsMinZ;
 
 	updateRectsMinZ.reserve(updateRects->size());
@@ -125,7 +152,7 @@ bool RenderObjectManager::render() {
 	// so don't need to be drawn in the first place which speeds things up a bit.
 	for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
 		int minZ = 0;
-		for (RenderObjectQueue::iterator it = _currQueue->reverse_begin(); it != _currQueue->end(); --it) {
+		for (RenderObjectQueue::const_iterator it = _currQueue->reverse_begin(); it != _currQueue->end(); --it) {
 			if ((*it)._renderObject->isVisible() && (*it)._renderObject->isSolid() &&
 				(*it)._renderObject->getBbox().contains(*rectIt)) {
 				minZ = (*it)._renderObject->getAbsoluteZ();
@@ -43,6 +43,9 @@
 #define SWORD25_RENDEROBJECTMANAGER_H
 
 #include "common/rect.h"
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/hash-ptr.h"
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/renderobjectptr.h"
 #include "sword25/kernel/persistable.h"
@@ -64,10 +67,31 @@ struct RenderObjectQueueItem {
 		: _renderObject(renderObject), _bbox(bbox), _version(version) {}
 };
 
-class RenderObjectQueue : public Common::List<RenderObjectQueueItem> {
+class RenderObjectQueue {
+	typedef Common::List<RenderObjectQueueItem> ItemList;
+
 public:
+	typedef ItemList::const_iterator const_iterator;
+
 	void add(RenderObject *renderObject);
-	bool exists(const RenderObjectQueueItem &renderObjectQueueItem);
+	bool exists(const RenderObjectQueueItem &renderObjectQueueItem) const;
+	void clear();
+
+	const_iterator begin() const { return _list.begin(); }
+	const_iterator reverse_begin() const { return _list.reverse_begin(); }
+	const_iterator end() const { return _list.end(); }
+	uint size() const { return _list.size(); }
+
+private:
+	// The list is only modified through add() and clear(), which keep the
+	// index in sync with it.
+	ItemList _list;
+
+	// Every object is queued at most once per frame, so the queue items can
+	// be looked up by object. This keeps the comparison of the previous and
+	// current frame linear in the number of objects.
+	typedef Common::HashMap<RenderObject *, const RenderObjectQueueItem *> ItemMap;
+	ItemMap _items;
 };
 
 /**
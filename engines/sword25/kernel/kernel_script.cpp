@@ -313,7 +313,7 @@ static int precacheResource(lua_State *L) {
 #ifdef PRECACHE_RESOURCES
 	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1)));
 #else
-	lua_pushbooleancpp(L, true);
+	lua_pushbooleancpp(L, pResource->queuePrecache(luaL_checkstring(L, 1)));
 #endif
 
 	return 1;
@@ -340,9 +340,8 @@ static int getMaxMemoryUsage(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-	// This is used for debugging, so it doesn't really matter.
 	// The default value set by the scripts is 256000000 bytes
-	lua_pushnumber(L, 256000000);
+	lua_pushnumber(L, pResource->getMaxMemoryUsage());
 
 	return 1;
 }
@@ -353,8 +352,17 @@ static int setMaxMemoryUsage(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-	// This call is ignored, we set a limit on the number of
-	// simultaneous resources loaded instead.
+	// Besides this limit, the number of simultaneously loaded
+	// resources is limited as well.
+	// Converting an out of range number is undefined, so clamp it first.
+	// The negated comparison also maps NaN to 0.
+	const lua_Number maxMemoryUsage = luaL_checknumber(L, 1);
+	if (!(maxMemoryUsage > 0))
+		pResource->setMaxMemoryUsage(0);
+	else if (maxMemoryUsage >= 0xFFFFFFFF)
+		pResource->setMaxMemoryUsage(0xFFFFFFFF);
+	else
+		pResource->setMaxMemoryUsage(static_cast<uint>(maxMemoryUsage));
 
 	return 0;
 }
@@ -29,6 +29,8 @@
  *
  */
 
+#include "common/system.h"
+
 #include "sword25/sword25.h"	// for kDebugResource
 #include "sword25/kernel/resmanager.h"
 #include "sword25/kernel/resource.h"
@@ -46,6 +48,16 @@ namespace Sword25 {
 // are loaded, the resource manager will start purging resources till it
 // hits the minimum limit above
 #define SWORD25_RESOURCECACHE_MAX 500
+// The default memory limit for the loaded resources in bytes. This is the
+// same value the scripts pass to Resource.SetMaxMemoryUsage(). When the limit
+// is exceeded, unlocked resources are purged until the usage drops to 3/4 of it.
+#define SWORD25_RESOURCECACHE_MEMORY_MAX 256000000
+
+ResourceManager::ResourceManager(Kernel *pKernel) :
+	_kernelPtr(pKernel),
+	_usedMemory(0),
+	_maxMemoryUsage(SWORD25_RESOURCECACHE_MEMORY_MAX) {
+}
 
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
@@ -87,9 +99,16 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (_resources.empty() ||
+		(_resources.size() < SWORD25_RESOURCECACHE_MAX && _usedMemory <= _maxMemoryUsage))
 		return;
 
+	// Only a purge caused by the resource count may go on to the minimum count below.
+	// A purge caused by the memory limit stops once the usage has dropped far enough.
+	const bool countExceeded = _resources.size() >= SWORD25_RESOURCECACHE_MAX;
+	const bool memoryExceeded = _usedMemory > _maxMemoryUsage;
+	const uint memoryTarget = _maxMemoryUsage - _maxMemoryUsage / 4;
+
 	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
 	// The list is processed backwards in order to first release those resources that have been
 	// not been accessed for the longest
@@ -100,14 +119,17 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		// The resource may be released only if it isn't locked
 		if ((*iter)->getLockCount() == 0)
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() &&
+	         ((countExceeded && _resources.size() >= SWORD25_RESOURCECACHE_MIN) ||
+	          (memoryExceeded && _usedMemory > memoryTarget)));
 
 	// Are we still above the minimum? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
 	// in the resource lock code, and resources are not unlocked when changing rooms.
 	// Only image/animation resources are unlocked forcibly, thus this shouldn't have
 	// any impact on the game itself.
-	if (_resources.size() <= SWORD25_RESOURCECACHE_MIN)
+	// Locked resources are never released to free memory, as they may still be in use.
+	if (!countExceeded || _resources.size() <= SWORD25_RESOURCECACHE_MIN)
 		return;
 
 	iter = _resources.end();
@@ -220,6 +242,55 @@ bool ResourceManager::precacheResource(const Common::String &fileName, bool forc
 
 #endif
 
+/**
+ * Queues a resource to be loaded into the cache at the end of one of the following frames
+ * @param FileName      The filename of the resource to be cached
+ */
+bool ResourceManager::queuePrecache(const Common::String &fileName) {
+	// Get the absolute path to the file
+	Common::String uniqueFileName = getUniqueFileName(fileName);
+	if (uniqueFileName.empty())
+		return false;
+
+	if (getResource(uniqueFileName))
+		return true;
+
+	// Loading a missing file later on would be fatal, so filter those out now
+	if (!_kernelPtr->getPackage()->fileExists(uniqueFileName)) {
+		debugC(kDebugResource, "Could not precache \"%s\",", fileName.c_str());
+		return false;
+	}
+
+	_precacheQueue.push(uniqueFileName);
+	return true;
+}
+
+/**
+ * Loads queued resources until the given time budget is exhausted
+ * @param Budget        The time budget in milliseconds
+ */
+void ResourceManager::processPrecacheQueue(uint32 budget) {
+	if (_precacheQueue.empty())
+		return;
+
+	const uint32 startTime = g_system->getMillis();
+	uint loaded = 0;
+
+	do {
+		Common::String uniqueFileName = _precacheQueue.pop();
+
+		// The scripts may have requested the resource in the meantime
+		if (getResource(uniqueFileName))
+			continue;
+
+		if (loadResource(uniqueFileName))
+			++loaded;
+	} while (!_precacheQueue.empty() && g_system->getMillis() - startTime < budget);
+
+	debugC(kDebugResource, "Precached %d resources in %d ms, %d remaining, %d bytes in use",
+	       loaded, g_system->getMillis() - startTime, _precacheQueue.size(), _usedMemory);
+}
+
 /**
  * Moves a resource to the top of the resource list
  * @param pResource     The resource
@@ -260,6 +331,8 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 			// Also store the resource in the hash table for quick lookup
 			_resourceHashMap[pResource->getFileName()] = pResource;
 
+			_usedMemory += pResource->getMemoryUsage();
+
 			return pResource;
 		}
 	}
@@ -296,6 +369,8 @@ Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pRe
 	// Remove the resource from the hash table
 	_resourceHashMap.erase(pResource->_fileName);
 
+	_usedMemory -= pResource->getMemoryUsage();
+
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
 
@@ -35,6 +35,7 @@
 #include "common/list.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#include "common/queue.h"
 
 #include "sword25/kernel/common.h"
 
@@ -66,6 +67,42 @@ public:
 	bool precacheResource(const Common::String &fileName, bool forceReload = false);
 #endif
 
+	/**
+	 * Queues a resource to be loaded into the cache at the end of one of the
+	 * following frames, so that scripts can announce the resources of a scene
+	 * without stalling the current frame.
+	 * @param FileName      The filename of the resource to be cached
+	 * @return              Returns false if the file does not exist.
+	 */
+	bool queuePrecache(const Common::String &fileName);
+
+	/**
+	 * Loads queued resources until the given time budget is exhausted.
+	 * At least one resource is loaded per call if the queue is not empty.
+	 * @param Budget        The time budget in milliseconds
+	 */
+	void processPrecacheQueue(uint32 budget);
+
+	/**
+	 * Sets the amount of memory the cached resources may use before
+	 * unlocked resources start getting purged.
+	 * @param MaxMemoryUsage    The limit in bytes
+	 */
+	void setMaxMemoryUsage(uint maxMemoryUsage) {
+		_maxMemoryUsage = maxMemoryUsage;
+	}
+
+	uint getMaxMemoryUsage() const {
+		return _maxMemoryUsage;
+	}
+
+	/**
+	 * Returns the approximate amount of memory used by all loaded resources.
+	 */
+	uint getUsedMemory() const {
+		return _usedMemory;
+	}
+
 	/**
 	 * Registers a RegisterResourceService. This method is the constructor of
 	 * BS_ResourceService, and thus helps all resource services in the ResourceManager list
@@ -93,9 +130,7 @@ private:
 	 * Creates a new resource manager
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
-	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
-	{}
+	ResourceManager(Kernel *pKernel);
 	virtual ~ResourceManager();
 
 	/**
@@ -139,6 +174,9 @@ private:
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+	Common::Queue<Common::String> _precacheQueue;
+	uint _usedMemory;
+	uint _maxMemoryUsage;
 };
 
 } // End of namespace Sword25
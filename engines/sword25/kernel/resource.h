@@ -92,6 +92,14 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns the approximate amount of memory used by the resource, in bytes.
+	 * This is used by the resource manager to decide when to purge the cache.
+	 */
+	virtual uint getMemoryUsage() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -217,6 +217,23 @@ void DrawBackgnd() {
 
 	// redraw all playfields within the clipping rectangles
 	const RectList &clipRects = GetClipRects();
+
+	// index the objects of each playfield, so that every clip rectangle
+	// only has to visit the objects it may contain
+	if (!clipRects.empty()) {
+		if ((int)_vm->_clipObjectIndex.size() < g_pCurBgnd->numPlayfields)
+			_vm->_clipObjectIndex.resize(g_pCurBgnd->numPlayfields);
+
+		for (i = 0; i < g_pCurBgnd->numPlayfields; i++) {
+			pPlay = g_pCurBgnd->fieldArray + i;
+
+			ptWin.x = fracToInt(pPlay->fieldX);
+			ptWin.y = fracToInt(pPlay->fieldY);
+
+			_vm->_clipObjectIndex[i].build(pPlay->pDispList, ptWin);
+		}
+	}
+
 	for (RectList::const_iterator r = clipRects.begin(); r != clipRects.end(); ++r) {
 		// clear the clip rectangle on the virtual screen
 		// for each background playfield
@@ -226,13 +243,9 @@ void DrawBackgnd() {
 			// get pointer to correct playfield
 			pPlay = g_pCurBgnd->fieldArray + i;
 
-			// convert fixed point window pos to a int
-			ptWin.x = fracToInt(pPlay->fieldX);
-			ptWin.y = fracToInt(pPlay->fieldY);
-
 			if (IntersectRectangle(rcPlayClip, pPlay->rcClip, *r))
 				// redraw all objects within this clipping rect
-				UpdateClipRect(&pPlay->pDispList, &ptWin,	&rcPlayClip);
+				_vm->_clipObjectIndex[i].update(rcPlayClip);
 		}
 	}
 
@@ -27,8 +27,16 @@
 #include "tinsel/palette.h"
 #include "tinsel/tinsel.h"		// for _vm
 
+#include "common/algorithm.h"
+
 namespace Tinsel {
 
+/**
+ * Estimated cost of redrawing an extra clip rectangle, in pixels. Rectangles
+ * are merged when the union is cheaper to redraw than the separate parts.
+ */
+#define CLIP_RECT_COST	(32 * 32)
+
 /**
  * Resets the clipping rectangle allocator.
  */
@@ -166,8 +174,28 @@ void FindMovingObjects(OBJECT **pObjList, Common::Point *pWin, Common::Rect *pCl
 }
 
 /**
- * Merges any clipping rectangles that overlap to try and reduce
- * the total number of clip rectangles.
+ * Check if redrawing the union of two rectangles is no more expensive
+ * than redrawing them separately.
+ * @param pSrc1			a source rectangle
+ * @param pSrc2			a source rectangle
+ */
+static bool WorthMerging(const Common::Rect &pSrc1, const Common::Rect &pSrc2) {
+	// rectangles that overlap or are next to each other are always
+	// merged, so that no part of the screen is redrawn twice
+	if (LooseIntersectRectangle(pSrc1, pSrc2))
+		return true;
+
+	Common::Rect rcUnion;
+	UnionRectangle(rcUnion, pSrc1, pSrc2);
+
+	return rcUnion.width() * rcUnion.height() <=
+		pSrc1.width() * pSrc1.height() + pSrc2.width() * pSrc2.height() + CLIP_RECT_COST;
+}
+
+/**
+ * Merges clipping rectangles that overlap, or are close enough to each
+ * other that redrawing their union is cheaper, to try and reduce the
+ * total number of clip rectangles.
  */
 void MergeClipRect() {
 	RectList &s_rectList = _vm->_clipRects;
@@ -178,22 +206,140 @@ void MergeClipRect() {
 	RectList::iterator rOuter, rInner;
 
 	for (rOuter = s_rectList.begin(); rOuter != s_rectList.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != s_rectList.end()) {
+		bool bGrown;
+
+		do {
+			// a grown rectangle can now be worth merging with
+			// rectangles it has already been checked against
+			bGrown = false;
+
+			rInner = rOuter;
+			++rInner;
+			while (rInner != s_rectList.end()) {
+				if (WorthMerging(*rOuter, *rInner)) {
+					UnionRectangle(*rOuter, *rOuter, *rInner);
+
+					// remove the inner rect from the list
+					rInner = s_rectList.erase(rInner);
+					bGrown = true;
+				} else {
+					++rInner;
+				}
+			}
+		} while (bGrown);
+	}
+}
 
-			if (LooseIntersectRectangle(*rOuter, *rInner)) {
-				// these two rectangles overlap or
-				// are next to each other - merge them
+/**
+ * Redraws an object within a clipping rectangle.
+ * @param pObj			Object to draw
+ * @param x				Object left, relative to the window
+ * @param y				Object top, relative to the window
+ * @param pClip			Clip rectangle
+ * @param currentObj	Drawing object to fill in
+ */
+static void UpdateClipObject(const OBJECT *pObj, int x, int y, const Common::Rect &pClip, DRAWOBJECT &currentObj) {
+	int right, bottom;	// object corners
+	int hclip, vclip;	// total size of object clipping
+
+	// calc object right
+	right = x + pObj->width;
+	if (right < 0)
+		// totally clipped if negative
+		return;
+
+	// calc object bottom
+	bottom = y + pObj->height;
+	if (bottom < 0)
+		// totally clipped if negative
+		return;
 
-				UnionRectangle(*rOuter, *rOuter, *rInner);
+	// bottom clip = low right y - clip low right y
+	currentObj.botClip = bottom - pClip.bottom;
+	if (currentObj.botClip < 0) {
+		// negative - object is not clipped
+		currentObj.botClip = 0;
+	}
 
-				// remove the inner rect from the list
-				s_rectList.erase(rInner);
+	// right clip = low right x - clip low right x
+	currentObj.rightClip = right - pClip.right;
+	if (currentObj.rightClip < 0) {
+		// negative - object is not clipped
+		currentObj.rightClip = 0;
+	}
 
-				// move back to beginning of list
-				rInner = rOuter;
-			}
-		}
+	// top clip = clip top left y - top left y
+	currentObj.topClip = pClip.top - y;
+	if (currentObj.topClip < 0) {
+		// negative - object is not clipped
+		currentObj.topClip = 0;
+	} else {	// clipped - adjust start position to top of clip rect
+		y = pClip.top;
+	}
+
+	// left clip = clip top left x - top left x
+	currentObj.leftClip = pClip.left - x;
+	if (currentObj.leftClip < 0) {
+		// negative - object is not clipped
+		currentObj.leftClip = 0;
+	} else {
+		// NOTE: This else statement is disabled in tinsel v1
+		// clipped - adjust start position to left of clip rect
+		x = pClip.left;
+	}
+
+	// calc object total horizontal clipping
+	hclip = currentObj.leftClip + currentObj.rightClip;
+
+	// calc object total vertical clipping
+	vclip = currentObj.topClip + currentObj.botClip;
+
+	if (hclip + vclip != 0) {
+		// object is clipped in some way
+
+		if (pObj->width <= hclip)
+			// object totally clipped horizontally - ignore
+			return;
+
+		if (pObj->height <= vclip)
+			// object totally clipped vertically - ignore
+			return;
+
+		// set clip bit in objects flags
+		currentObj.flags = pObj->flags | DMA_CLIP;
+	} else {	// object is not clipped - copy flags
+		currentObj.flags = pObj->flags;
+	}
+
+	// copy objects properties to local object
+	currentObj.width    = pObj->width;
+	currentObj.height   = pObj->height;
+	currentObj.xPos     = (short)x;
+	currentObj.yPos     = (short)y;
+	currentObj.pPal     = pObj->pPal;
+	currentObj.constant = pObj->constant;
+	currentObj.hBits    = pObj->hBits;
+
+	// draw the object
+	DrawObject(&currentObj);
+}
+
+/**
+ * Calculates the position of an object relative to a window.
+ * @param pObj			Object
+ * @param pWin			Window top left position
+ * @param x				Receives the object left
+ * @param y				Receives the object top
+ */
+static void GetClipObjectPos(const OBJECT *pObj, const Common::Point &pWin, int &x, int &y) {
+	if (pObj->flags & DMA_ABS) {
+		// object position is absolute
+		x = fracToInt(pObj->xPos);
+		y = fracToInt(pObj->yPos);
+	} else {
+		// object position is relative to window
+		x = fracToInt(pObj->xPos) - pWin.x;
+		y = fracToInt(pObj->yPos) - pWin.y;
 	}
 }
 
@@ -204,105 +350,74 @@ void MergeClipRect() {
  * @param pClip			Pointer to clip rectangle
  */
 void UpdateClipRect(OBJECT **pObjList, Common::Point *pWin, Common::Rect *pClip) {
-	int x, y, right, bottom;	// object corners
-	int hclip, vclip;			// total size of object clipping
 	DRAWOBJECT currentObj;		// filled in to draw the current object in list
 	OBJECT *pObj;				// object list iterator
+	int x, y;					// object top left
 
 	// Initialize the fields of the drawing object to empty
 	memset(&currentObj, 0, sizeof(DRAWOBJECT));
 
 	for (pObj = *pObjList; pObj != NULL; pObj = pObj->pNext) {
-		if (pObj->flags & DMA_ABS) {
-			// object position is absolute
-			x = fracToInt(pObj->xPos);
-			y = fracToInt(pObj->yPos);
-		} else {
-			// object position is relative to window
-			x = fracToInt(pObj->xPos) - pWin->x;
-			y = fracToInt(pObj->yPos) - pWin->y;
-		}
-
-		// calc object right
-		right = x + pObj->width;
-		if (right < 0)
-			// totally clipped if negative
-			continue;
-
-		// calc object bottom
-		bottom = y + pObj->height;
-		if (bottom < 0)
-			// totally clipped if negative
-			continue;
+		GetClipObjectPos(pObj, *pWin, x, y);
+		UpdateClipObject(pObj, x, y, *pClip, currentObj);
+	}
+}
 
-		// bottom clip = low right y - clip low right y
-		currentObj.botClip = bottom - pClip->bottom;
-		if (currentObj.botClip < 0) {
-			// negative - object is not clipped
-			currentObj.botClip = 0;
-		}
+void ClipObjectIndex::build(OBJECT *pObjList, const Common::Point &ptWin) {
+	_objects.clear();
+	for (int i = 0; i < kNumBands; i++)
+		_bands[i].clear();
 
-		// right clip = low right x - clip low right x
-		currentObj.rightClip = right - pClip->right;
-		if (currentObj.rightClip < 0) {
-			// negative - object is not clipped
-			currentObj.rightClip = 0;
-		}
+	for (OBJECT *pObj = pObjList; pObj != NULL; pObj = pObj->pNext) {
+		Entry entry;
+		entry.pObj = pObj;
+		GetClipObjectPos(pObj, ptWin, entry.x, entry.y);
 
-		// top clip = clip top left y - top left y
-		currentObj.topClip = pClip->top - y;
-		if (currentObj.topClip < 0) {
-			// negative - object is not clipped
-			currentObj.topClip = 0;
-		} else {	// clipped - adjust start position to top of clip rect
-			y = pClip->top;
-		}
+		int bottom = entry.y + pObj->height;
+		if (entry.x + pObj->width < 0 || bottom < 0)
+			// totally clipped whatever the clip rectangle is
+			continue;
 
-		// left clip = clip top left x - top left x
-		currentObj.leftClip = pClip->left - x;
-		if (currentObj.leftClip < 0) {
-			// negative - object is not clipped
-			currentObj.leftClip = 0;
-		} else {
-			// NOTE: This else statement is disabled in tinsel v1
-			// clipped - adjust start position to left of clip rect
-			x = pClip->left;
-		}
+		int first = MIN(MAX(entry.y, 0) >> kBandShift, (int)kNumBands - 1);
+		int last = MIN(MAX(MAX(bottom - 1, entry.y), 0) >> kBandShift, (int)kNumBands - 1);
+		for (int band = first; band <= last; band++)
+			_bands[band].push_back(_objects.size());
 
-		// calc object total horizontal clipping
-		hclip = currentObj.leftClip + currentObj.rightClip;
+		_objects.push_back(entry);
+	}
+}
 
-		// calc object total vertical clipping
-		vclip = currentObj.topClip + currentObj.botClip;
+void ClipObjectIndex::update(const Common::Rect &rcClip) {
+	DRAWOBJECT currentObj;		// filled in to draw the current object in list
 
-		if (hclip + vclip != 0) {
-			// object is clipped in some way
+	if (rcClip.isEmpty())
+		return;
 
-			if (pObj->width <= hclip)
-				// object totally clipped horizontally - ignore
-				continue;
+	// Initialize the fields of the drawing object to empty
+	memset(&currentObj, 0, sizeof(DRAWOBJECT));
 
-			if (pObj->height <= vclip)
-				// object totally clipped vertically - ignore
-				continue;
+	int first = MIN(MAX((int)rcClip.top, 0) >> kBandShift, (int)kNumBands - 1);
+	int last = MIN(MAX(rcClip.bottom - 1, 0) >> kBandShift, (int)kNumBands - 1);
+
+	const Common::Array<uint> *candidates = &_bands[first];
+	if (first != last) {
+		// gather the objects of all bands, and restore the drawing order
+		_candidates.clear();
+		for (int band = first; band <= last; band++)
+			_candidates.push_back(_bands[band]);
+		Common::sort(_candidates.begin(), _candidates.end());
+		candidates = &_candidates;
+	}
 
-			// set clip bit in objects flags
-			currentObj.flags = pObj->flags | DMA_CLIP;
-		} else {	// object is not clipped - copy flags
-			currentObj.flags = pObj->flags;
-		}
+	uint prev = (uint)-1;
+	for (Common::Array<uint>::const_iterator i = candidates->begin(); i != candidates->end(); ++i) {
+		if (*i == prev)
+			// object spans several bands
+			continue;
+		prev = *i;
 
-		// copy objects properties to local object
-		currentObj.width    = pObj->width;
-		currentObj.height   = pObj->height;
-		currentObj.xPos     = (short)x;
-		currentObj.yPos     = (short)y;
-		currentObj.pPal     = pObj->pPal;
-		currentObj.constant = pObj->constant;
-		currentObj.hBits    = pObj->hBits;
-
-		// draw the object
-		DrawObject(&currentObj);
+		const Entry &entry = _objects[*i];
+		UpdateClipObject(entry.pObj, entry.x, entry.y, rcClip, currentObj);
 	}
 }
 
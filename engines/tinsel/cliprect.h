@@ -24,6 +24,7 @@
 #ifndef TINSEL_CLIPRECT_H     // prevent multiple includes
 #define TINSEL_CLIPRECT_H
 
+#include "common/array.h"
 #include "common/list.h"
 #include "common/rect.h"
 
@@ -33,6 +34,35 @@ struct OBJECT;
 
 typedef Common::List<Common::Rect> RectList;
 
+/**
+ * Screen positions of all objects on a display list, bucketed into bands of
+ * screen lines. Redrawing a clip rectangle only visits the objects in the
+ * bands it covers, rather than every object on the list.
+ */
+class ClipObjectIndex {
+public:
+	/** Records the positions of all objects on the list, in list order. */
+	void build(OBJECT *pObjList, const Common::Point &ptWin);
+
+	/** Redraws all recorded objects within the clip rectangle. */
+	void update(const Common::Rect &rcClip);
+
+private:
+	enum {
+		kBandShift = 4,		///< each band covers 16 screen lines
+		kNumBands = 64		///< the last band also holds everything below it
+	};
+
+	struct Entry {
+		OBJECT *pObj;
+		int x, y;
+	};
+
+	Common::Array<Entry> _objects;
+	Common::Array<uint> _bands[kNumBands];	///< indices into _objects, ascending
+	Common::Array<uint> _candidates;
+};
+
 /*----------------------------------------------------------------------*\
 |*			Clip Rect Function Prototypes			*|
 \*----------------------------------------------------------------------*/
@@ -61,7 +91,7 @@ void FindMovingObjects(		// Creates clipping rectangles for all the objects that
 	bool bVelocity,		// when set, objects pos is updated with velocity
 	bool bScrolled);	// when set, playfield has scrolled
 
-void MergeClipRect();	// Merges any clipping rectangles that overlap
+void MergeClipRect();	// Merges clipping rectangles where that reduces the redraw cost
 
 void UpdateClipRect(		// Redraws all objects within this clipping rectangle
 	OBJECT **pObjList,	// object list to draw
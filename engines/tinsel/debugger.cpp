@@ -28,6 +28,7 @@
 #include "tinsel/sound.h"
 #include "tinsel/music.h"
 #include "tinsel/font.h"
+#include "tinsel/heapmem.h"
 #include "tinsel/strres.h"
 
 namespace Tinsel {
@@ -67,6 +68,7 @@ Console::Console() : GUI::Debugger() {
 	registerCmd("music",		WRAP_METHOD(Console, cmd_music));
 	registerCmd("sound",		WRAP_METHOD(Console, cmd_sound));
 	registerCmd("string",		WRAP_METHOD(Console, cmd_string));
+	registerCmd("memory",		WRAP_METHOD(Console, cmd_memory));
 }
 
 Console::~Console() {
@@ -161,4 +163,13 @@ bool Console::cmd_string(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmd_memory(int argc, const char **argv) {
+	const MEMORY_STATS &stats = MemoryGetStats();
+
+	debugPrintf("Heap: %ld bytes free, %ld bytes kept in the discard cache\n", stats.heapFree, stats.cacheSize);
+	debugPrintf("%u blocks discarded, %u restored from the cache, %u loaded from disk\n", stats.discards, stats.restores, stats.loads);
+
+	return true;
+}
+
 } // End of namespace Tinsel
@@ -40,6 +40,7 @@ private:
 	bool cmd_music(int argc, const char **argv);
 	bool cmd_sound(int argc, const char **argv);
 	bool cmd_string(int argc, const char **argv);
+	bool cmd_memory(int argc, const char **argv);
 };
 
 } // End of namespace Tinsel
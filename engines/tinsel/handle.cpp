@@ -343,8 +343,8 @@ byte *LockMem(SCNHANDLE offset) {
 			error("Overlapping (in time) CD-plays");
 
 		// May have been discarded, if so, we have to reload
-		if (!MemoryDeref(pH->_node)) {
-			// Data was discarded, we have to reload
+		if (!MemoryDeref(pH->_node) && !MemoryRestore(pH->_node)) {
+			// Data was discarded and no copy was kept, we have to reload
 			MemoryReAlloc(pH->_node, g_cdTopHandle - g_cdBaseHandle);
 
 			LoadCDGraphData(pH);
@@ -358,8 +358,8 @@ byte *LockMem(SCNHANDLE offset) {
 
 		offset -= g_cdBaseHandle;
 	} else {
-		if (!MemoryDeref(pH->_node)) {
-			// Data was discarded, we have to reload
+		if (!MemoryDeref(pH->_node) && !MemoryRestore(pH->_node)) {
+			// Data was discarded and no copy was kept, we have to reload
 			MemoryReAlloc(pH->_node, pH->filesize & FSIZE_MASK);
 
 			if (TinselV2) {
@@ -395,7 +395,9 @@ void LockScene(SCNHANDLE offset) {
 	pH = g_handleTable + handle;
 
 	if ((pH->filesize & fPreload) == 0) {
-		// Ensure the scene handle is allocated.
+		// Ensure the scene handle is allocated, preferably with its old contents.
+		if (!MemoryDeref(pH->_node))
+			MemoryRestore(pH->_node);
 		MemoryReAlloc(pH->_node, pH->filesize & FSIZE_MASK);
 
 		// Now lock it to make sure it stays allocated and in a fixed position.
@@ -45,6 +45,8 @@ struct MEM_NODE {
 	long size;		// size of the memory object
 	uint32 lruTime;		// time when memory object was last accessed
 	int flags;		// allocation attributes
+	uint8 *pCacheAddr;	// copy of the contents kept after being discarded
+	long cacheSize;		// size of the kept copy
 };
 
 
@@ -69,6 +71,16 @@ MEM_NODE g_s_fixedMnodesList[5];
 // the mnode heap sentinel
 static MEM_NODE g_heapSentinel;
 
+// Blocks discarded to make room on the heap are kept in a secondary cache,
+// up to this many bytes, so that they can be restored without reloading
+static long g_cacheLimit;
+
+// the number of bytes currently kept in the secondary cache
+static long g_cacheSize;
+
+// memory manager statistics
+static MEMORY_STATS g_memoryStats;
+
 //
 static MEM_NODE *AllocMemNode();
 
@@ -130,6 +142,12 @@ void MemoryInit() {
 	if (TinselVersion == TINSEL_V1) size = MemoryPoolSize[1];
 	else if (TinselVersion == TINSEL_V2) size = MemoryPoolSize[2];
 	g_heapSentinel.size = size;
+
+	// the secondary cache may hold as much as the heap itself
+	g_cacheLimit = size;
+	g_cacheSize = 0;
+
+	memset(&g_memoryStats, 0, sizeof(g_memoryStats));
 }
 
 /**
@@ -148,7 +166,10 @@ void MemoryDeinit() {
 	for (pCur = pHeap->pNext; pCur != pHeap; pCur = pCur->pNext) {
 		free(pCur->pBaseAddr);
 		pCur->pBaseAddr = 0;
+		free(pCur->pCacheAddr);
+		pCur->pCacheAddr = 0;
 	}
+	g_cacheSize = 0;
 }
 
 
@@ -188,6 +209,80 @@ void FreeMemNode(MEM_NODE *pMemNode) {
 }
 
 
+/**
+ * Frees the copy of a discarded memory object kept in the secondary cache.
+ * @param pMemNode			Node of the memory object
+ */
+static void CacheDrop(MEM_NODE *pMemNode) {
+	if (pMemNode->pCacheAddr) {
+		free(pMemNode->pCacheAddr);
+		g_cacheSize -= pMemNode->cacheSize;
+
+		pMemNode->pCacheAddr = NULL;
+		pMemNode->cacheSize = 0;
+	}
+}
+
+/**
+ * Frees the least recently used copies in the secondary cache until it
+ * fits within its limit again.
+ */
+static void CacheTrim() {
+	const MEM_NODE *pHeap = &g_heapSentinel;
+	MEM_NODE *pCur, *pOldest;
+
+	while (g_cacheSize > g_cacheLimit) {
+		pOldest = NULL;
+		for (pCur = pHeap->pNext; pCur != pHeap; pCur = pCur->pNext) {
+			if (pCur->pCacheAddr && (!pOldest || pCur->lruTime < pOldest->lruTime))
+				pOldest = pCur;
+		}
+
+		assert(pOldest);
+		CacheDrop(pOldest);
+	}
+}
+
+/**
+ * Discards the specified memory object.
+ * @param pMemNode			Node of the memory object
+ * @param bKeepCopy			When set, the contents are moved to the secondary cache
+ */
+static void DiscardNode(MEM_NODE *pMemNode, bool bKeepCopy) {
+	// validate mnode pointer
+	assert(pMemNode >= g_mnodeList && pMemNode <= g_mnodeList + NUM_MNODES - 1);
+
+	// object must be in use and locked
+	assert((pMemNode->flags & (DWM_USED | DWM_LOCKED)) == DWM_USED);
+
+	// discard it if it isn't already
+	if ((pMemNode->flags & DWM_DISCARDED) == 0) {
+		if (bKeepCopy && pMemNode->size <= g_cacheLimit) {
+			// hand the memory over to the secondary cache
+			assert(!pMemNode->pCacheAddr);
+			pMemNode->pCacheAddr = pMemNode->pBaseAddr;
+			pMemNode->cacheSize = pMemNode->size;
+			g_cacheSize += pMemNode->size;
+		} else {
+			// free memory
+			free(pMemNode->pBaseAddr);
+		}
+		g_heapSentinel.size += pMemNode->size;
+
+#ifdef DEBUG
+		MemoryStats();
+#endif
+
+		// mark the node as discarded
+		pMemNode->flags |= DWM_DISCARDED;
+		pMemNode->pBaseAddr = NULL;
+		pMemNode->size = 0;
+
+		if (bKeepCopy)
+			CacheTrim();
+	}
+}
+
 /**
  * Tries to make space for the specified number of bytes on the specified heap.
  * @param size			Number of bytes to free up
@@ -213,10 +308,11 @@ static bool HeapCompact(long size) {
 			}
 		}
 
-		if (pOldest)
+		if (pOldest) {
 			// discard the oldest block
-			MemoryDiscard(pOldest);
-		else
+			DiscardNode(pOldest, true);
+			g_memoryStats.discards++;
+		} else
 			// cannot discard any blocks
 			return false;
 	}
@@ -337,31 +433,49 @@ MEM_NODE *MemoryAllocFixed(long size) {
 
 
 /**
- * Discards the specified memory object.
+ * Discards the specified memory object. Its contents are not kept, as
+ * explicit discards are made when the contents are about to change.
  * @param pMemNode			Node of the memory object
  */
 void MemoryDiscard(MEM_NODE *pMemNode) {
+	DiscardNode(pMemNode, false);
+	CacheDrop(pMemNode);
+}
+
+/**
+ * Restores a discarded memory object from the secondary cache.
+ * @param pMemNode			Node of the memory object
+ * @return true if the contents were restored, false if they have to be reloaded
+ */
+bool MemoryRestore(MEM_NODE *pMemNode) {
 	// validate mnode pointer
 	assert(pMemNode >= g_mnodeList && pMemNode <= g_mnodeList + NUM_MNODES - 1);
 
-	// object must be in use and locked
-	assert((pMemNode->flags & (DWM_USED | DWM_LOCKED)) == DWM_USED);
-
-	// discard it if it isn't already
-	if ((pMemNode->flags & DWM_DISCARDED) == 0) {
-		// free memory
-		free(pMemNode->pBaseAddr);
-		g_heapSentinel.size += pMemNode->size;
+	if (!(pMemNode->flags & DWM_DISCARDED) || !pMemNode->pCacheAddr)
+		return false;
 
-#ifdef DEBUG
-		MemoryStats();
-#endif
+	// take the copy out of the cache first, so that making room
+	// on the heap cannot evict it
+	uint8 *addr = pMemNode->pCacheAddr;
+	long size = pMemNode->cacheSize;
+	pMemNode->pCacheAddr = NULL;
+	pMemNode->cacheSize = 0;
+	g_cacheSize -= size;
 
-		// mark the node as discarded
-		pMemNode->flags |= DWM_DISCARDED;
-		pMemNode->pBaseAddr = NULL;
-		pMemNode->size = 0;
+	if (!HeapCompact(size)) {
+		free(addr);
+		return false;
 	}
+
+	g_heapSentinel.size -= size;
+
+	pMemNode->pBaseAddr = addr;
+	pMemNode->size = size;
+	pMemNode->flags &= ~DWM_DISCARDED;
+	pMemNode->lruTime = DwGetCurrentTime();
+
+	g_memoryStats.restores++;
+	return true;
 }
 
 /**
@@ -429,6 +543,10 @@ void MemoryReAlloc(MEM_NODE *pMemNode, long size) {
 		assert(pMemNode->flags == (DWM_USED | DWM_DISCARDED));
 		assert(pMemNode->size == 0);
 
+		// the caller loads new contents, so any kept copy is stale
+		CacheDrop(pMemNode);
+		g_memoryStats.loads++;
+
 		// unlink the mnode from the current heap
 		pMemNode->pNext->pPrev = pMemNode->pPrev;
 		pMemNode->pPrev->pNext = pMemNode->pNext;
@@ -466,5 +584,14 @@ uint8 *MemoryDeref(MEM_NODE *pMemNode) {
 	return pMemNode->pBaseAddr;
 }
 
+/**
+ * Returns the memory manager statistics.
+ */
+const MEMORY_STATS &MemoryGetStats() {
+	g_memoryStats.heapFree = g_heapSentinel.size;
+	g_memoryStats.cacheSize = g_cacheSize;
+	return g_memoryStats;
+}
+
 
 } // End of namespace Tinsel
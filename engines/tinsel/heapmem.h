@@ -30,6 +30,15 @@ namespace Tinsel {
 
 struct MEM_NODE;
 
+/** memory manager statistics, reported by the debugger */
+struct MEMORY_STATS {
+	uint32 discards;	///< blocks discarded to make room on the heap
+	uint32 restores;	///< discarded blocks restored from the secondary cache
+	uint32 loads;		///< blocks (re)loaded from disk
+	long heapFree;		///< free bytes on the emulated heap
+	long cacheSize;		///< bytes kept in the secondary cache
+};
+
 
 /*----------------------------------------------------------------------*\
 |*			Memory Function Prototypes			*|
@@ -47,6 +56,9 @@ MEM_NODE *MemoryAllocFixed(long size);
 void MemoryDiscard(		// discards the specified memory object
 	MEM_NODE *pMemNode);	// node of the memory object
 
+bool MemoryRestore(		// restores a discarded memory object from the secondary cache
+	MEM_NODE *pMemNode);	// node of the memory object
+
 void *MemoryLock(		// locks a memory object and returns a pointer to the first byte of the objects memory block
 	MEM_NODE *pMemNode);	// node of the memory object
 
@@ -63,6 +75,9 @@ void MemoryTouch(MEM_NODE *pMemNode);
 // Dereference a given memory node
 uint8 *MemoryDeref(MEM_NODE *pMemNode);
 
+// Returns the memory manager statistics
+const MEMORY_STATS &MemoryGetStats();
+
 } // End of namespace Tinsel
 
 #endif
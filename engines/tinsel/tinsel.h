@@ -34,6 +34,7 @@
 #include "engines/engine.h"
 #include "gui/debugger.h"
 
+#include "tinsel/cliprect.h"
 #include "tinsel/debugger.h"
 #include "tinsel/graphics.h"
 #include "tinsel/sound.h"
@@ -57,8 +58,6 @@ class MidiMusicPlayer;
 class PCMMusicPlayer;
 class SoundManager;
 
-typedef Common::List<Common::Rect> RectList;
-
 enum TinselGameID {
 	GID_DW1 = 0,
 	GID_DW2 = 1
@@ -214,6 +213,9 @@ public:
 	/** List of all clip rectangles. */
 	RectList _clipRects;
 
+	/** Object positions of every background playfield, rebuilt every frame. */
+	Common::Array<ClipObjectIndex> _clipObjectIndex;
+
 private:
 	void NextGameCycle();
 	void CreateConstProcesses();
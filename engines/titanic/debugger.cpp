@@ -29,6 +29,7 @@
 #include "titanic/game/movie_tester.h"
 #include "titanic/main_game_window.h"
 #include "titanic/pet_control/pet_control.h"
+#include "titanic/star_control/star_control.h"
 #include "titanic/support/movie.h"
 #include "titanic/titanic.h"
 #include "common/str-array.h"
@@ -45,6 +46,7 @@ Debugger::Debugger(TitanicEngine *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("sound",		WRAP_METHOD(Debugger, cmdSound));
 	registerCmd("cheat",        WRAP_METHOD(Debugger, cmdCheat));
 	registerCmd("frame",        WRAP_METHOD(Debugger, cmdFrame));
+	registerCmd("starbench",    WRAP_METHOD(Debugger, cmdStarBench));
 }
 
 int Debugger::strToInt(const char *s) {
@@ -371,4 +373,32 @@ bool Debugger::cmdFrame(int argc, const char **argv) {
 	}
 }
 
+bool Debugger::cmdStarBench(int argc, const char **argv) {
+	CViewItem *view = g_vm->_window->_gameManager->getView();
+	CStarControl *starControl = view ? dynamic_cast<CStarControl *>(
+		view->findChildInstanceOf(CStarControl::_type)) : nullptr;
+
+	if (!starControl) {
+		debugPrintf("The starfield is not in the current view\n");
+		return true;
+	}
+
+	uint frames = (argc >= 2) ? strToInt(argv[1]) : 50;
+	Common::Array<uint32> times = starControl->benchmark(frames);
+	if (times.empty()) {
+		debugPrintf("The starfield is not being shown\n");
+		return true;
+	}
+
+	uint32 total = 0;
+	for (uint idx = 0; idx < times.size(); ++idx) {
+		debugPrintf("Pose %d: %d.%03d ms\n", idx, times[idx] / 1000, times[idx] % 1000);
+		total += times[idx];
+	}
+
+	total /= times.size();
+	debugPrintf("Average: %d.%03d ms over %d frames per pose\n", total / 1000, total % 1000, frames);
+	return true;
+}
+
 } // End of namespace Titanic
@@ -120,6 +120,11 @@ private:
 	 * Set the movie frame for a given object
 	 */
 	bool cmdFrame(int argc, const char **argv);
+
+	/**
+	 * Time rendering the starfield
+	 */
+	bool cmdStarBench(int argc, const char **argv);
 protected:
 	TitanicEngine *_vm;
 public:
@@ -65,6 +65,7 @@ CBaseStars::CBaseStars() : _minVal(0.0), _maxVal(1.0), _range(0.0),
 
 void CBaseStars::clear() {
 	_data.clear();
+	updatePositions();
 }
 
 void CBaseStars::initialize() {
@@ -102,6 +103,8 @@ void CBaseStars::loadData(Common::SeekableReadStream &s) {
 	// Iterate through reading the data for each entry
 	for (uint idx = 0; idx < count; ++idx)
 		_data[idx].load(s);
+
+	updatePositions();
 }
 
 void CBaseStars::loadData(const CString &resName) {
@@ -161,9 +164,94 @@ void CBaseStars::draw(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClose
 	}
 }
 
+void CBaseStars::updatePositions() {
+	uint count = _data.size();
+	_posX.resize(count);
+	_posY.resize(count);
+	_posZ.resize(count);
+	_viewX.resize(count);
+	_viewY.resize(count);
+	_viewZ.resize(count);
+
+	for (uint idx = 0; idx < count; ++idx) {
+		const FVector &position = _data[idx]._position;
+		_posX[idx] = position._x;
+		_posY[idx] = position._y;
+		_posZ[idx] = position._z;
+	}
+}
+
+void CBaseStars::projectStars(const FPose &pose) {
+	if (_posX.size() != _data.size())
+		updatePositions();
+
+	const uint count = _data.size();
+	const float *srcX = _posX.data();
+	const float *srcY = _posY.data();
+	const float *srcZ = _posZ.data();
+
+	// Each axis is done in its own pass over plain float arrays, which the
+	// compiler turns into SIMD code where available
+	float *dest = _viewZ.data();
+	const float zx = pose._row1._z, zy = pose._row2._z, zz = pose._row3._z, zv = pose._vector._z;
+	for (uint idx = 0; idx < count; ++idx)
+		dest[idx] = srcX[idx] * zx + srcY[idx] * zy + srcZ[idx] * zz + zv;
+
+	dest = _viewY.data();
+	const float yx = pose._row1._y, yy = pose._row2._y, yz = pose._row3._y, yv = pose._vector._y;
+	for (uint idx = 0; idx < count; ++idx)
+		dest[idx] = srcX[idx] * yx + srcY[idx] * yy + srcZ[idx] * yz + yv;
+
+	dest = _viewX.data();
+	const float xx = pose._row1._x, xy = pose._row2._x, xz = pose._row3._x, xv = pose._vector._x;
+	for (uint idx = 0; idx < count; ++idx)
+		dest[idx] = srcX[idx] * xx + srcY[idx] * xy + srcZ[idx] * xz + xv;
+}
+
+static inline void plotStar(CSurfaceArea *surfaceArea, int x, int y, int thickness, uint16 rgb) {
+	uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * y + x * 2);
+
+	switch (thickness) {
+	case 0:
+		*pixelP = rgb;
+		break;
+
+	case 1:
+		*pixelP = rgb;
+		*(pixelP + 1) = rgb;
+		*(pixelP + surfaceArea->_pitch / 2) = rgb;
+		*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+		break;
+
+	default:
+		break;
+	}
+}
+
+static inline void blendStar(CSurfaceArea *surfaceArea, int x, int y, int thickness, uint16 rgb) {
+	uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * y + x * 2);
+
+	switch (thickness) {
+	case 0:
+		*pixelP |= rgb;
+		break;
+
+	case 1:
+		*pixelP |= rgb;
+		*(pixelP + 1) |= rgb;
+		*(pixelP + surfaceArea->_pitch / 2) |= rgb;
+		*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+		break;
+
+	default:
+		break;
+	}
+}
+
 void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
 	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(pose);
 
 	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
@@ -171,23 +259,20 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		tempZ = _viewZ[idx];
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ; 
+		const CBaseStarEntry &entry = _data[idx];
+		tempY = _viewY[idx];
+		tempX = _viewX[idx];
+		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
 		}
@@ -195,8 +280,8 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (tempZ <= threshold || total2 >= MAX_VAL)
 			continue;
 
-		int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
-		int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
+		int xStart = (int)(_value1 * tempX / tempZ + centroid._x);
+		int yStart = (int)(_value2 * tempY / tempZ + centroid._y);
 		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
 			continue;
 
@@ -226,29 +311,15 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		int g = (int)(green - 0.5) & 0xfff8;
 		int b = (int)(blue - 0.5) & 0xfff8;
 		int rgb = ((g | (r << 5)) << 2) | ((b >> 3) & 0xfff8);
-		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-
-		switch (entry._thickness) {
-		case 0:
-			*pixelP = rgb;
-			break;
 
-		case 1:
-			*pixelP = rgb;
-			*(pixelP + 1) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-			break;
-
-		default:
-			break;
-		}
+		plotStar(surfaceArea, xStart, yStart, entry._thickness, rgb);
 	}
 }
 
 void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
 	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(pose);
 
 	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
@@ -256,23 +327,20 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		tempZ = _viewZ[idx];
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		const CBaseStarEntry &entry = _data[idx];
+		tempY = _viewY[idx];
+		tempX = _viewX[idx];
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
 		}
@@ -280,8 +348,8 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (tempZ <= threshold || total2 >= MAX_VAL)
 			continue;
 
-		int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
-		int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
+		int xStart = (int)(_value1 * tempX / tempZ + centroid._x);
+		int yStart = (int)(_value2 * tempY / tempZ + centroid._y);
 		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
 			continue;
 
@@ -310,31 +378,16 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		int r = (int)(red - 0.5) & 0xf8;
 		int g = (int)(green - 0.5) & 0xfc;
 		int b = (int)(blue - 0.5) & 0xfff8;
-
 		int rgb = ((g | (r << 5)) << 3) | (b >> 3);
-		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 
-		switch (entry._thickness) {
-		case 0:
-			*pixelP = rgb;
-			break;
-
-		case 1:
-			*pixelP = rgb;
-			*(pixelP + 1) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-			break;
-
-		default:
-			break;
-		}
+		plotStar(surfaceArea, xStart, yStart, entry._thickness, rgb);
 	}
 }
 
 void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
 	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(pose);
 
 	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
@@ -342,26 +395,21 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2;
-	double *v3Ptr = &_value3, *v4Ptr = &_value4;
 	double tempX, tempY, tempZ, total2, sVal;
 	int xStart, yStart, rgb;
-	uint16 *pixelP;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		tempZ = _viewZ[idx];
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		const CBaseStarEntry &entry = _data[idx];
+		tempY = _viewY[idx];
+		tempX = _viewX[idx];
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
 		}
@@ -369,12 +417,7 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (tempZ <= threshold || total2 >= MAX_VAL)
 			continue;
 
-		// First pixel
-		xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
-
+		// Both pixels share the same brightness
 		sVal = sqrt(total2);
 		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
 		sVal *= 255.0;
@@ -382,59 +425,25 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (sVal > 255.0)
 			sVal = 255.0;
 
+		// First pixel
+		xStart = (int)((tempX + _value3) * _value1 / tempZ + centroid._x);
+		yStart = (int)(tempY * _value2 / tempZ + centroid._y);
+		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+			continue;
+
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
-
-			switch (entry._thickness) {
-			case 0:
-				*pixelP = rgb;
-				break;
-
-			case 1:
-				*pixelP = rgb;
-				*(pixelP + 1) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-				break;
-
-			default:
-				break;
-			}
+			plotStar(surfaceArea, xStart, yStart, entry._thickness, rgb);
 		}
 
 		// Second pixel
-		xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+		xStart = (int)((tempX + _value4) * _value1 / tempZ + centroid._x);
+		if (xStart < 0 || xStart >= width1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
-
-			switch (entry._thickness) {
-			case 0:
-				*pixelP |= rgb;
-				break;
-
-			case 1:
-				*pixelP |= rgb;
-				*(pixelP + 1) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
-				break;
-
-			default:
-				break;
-			}
+			blendStar(surfaceArea, xStart, yStart, entry._thickness, rgb);
 		}
 	}
 }
@@ -442,6 +451,7 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
 	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(pose);
 
 	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
@@ -449,27 +459,22 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2, *v3Ptr = &_value3, *v4Ptr = &_value4;
 	double tempX, tempY, tempZ, total2, sVal;
 	int xStart, yStart, rgb;
-	uint16 *pixelP;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
-		const CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
+		tempZ = _viewZ[idx];
 		if (tempZ <= minVal)
 			continue;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
+		const CBaseStarEntry &entry = _data[idx];
+		tempY = _viewY[idx];
+		tempX = _viewX[idx];
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
 			// We're in close proximity to the given star, so draw a closeup of it
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
 		}
@@ -477,12 +482,7 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (tempZ <= threshold || total2 >= MAX_VAL)
 			continue;
 
-		// First pixel
-		xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
-			continue;
-
+		// Both pixels share the same brightness
 		sVal = sqrt(total2);
 		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
 		sVal *= 255.0;
@@ -490,59 +490,25 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 		if (sVal > 255.0)
 			sVal = 255.0;
 
+		// First pixel
+		xStart = (int)((tempX + _value3) * _value1 / tempZ + centroid._x);
+		yStart = (int)(tempY * _value2 / tempZ + centroid._y);
+		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+			continue;
+
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 8;
-
-			switch (entry._thickness) {
-			case 0:
-				*pixelP = rgb;
-				break;
-
-			case 1:
-				*pixelP = rgb;
-				*(pixelP + 1) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
-				break;
-
-			default:
-				break;
-			}
+			plotStar(surfaceArea, xStart, yStart, entry._thickness, rgb);
 		}
 
 		// Second pixel
-		xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)((tempY * *v2Ptr) / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+		xStart = (int)((tempX + _value4) * _value1 / tempZ + centroid._x);
+		if (xStart < 0 || xStart >= width1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
 			rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
-
-			switch (entry._thickness) {
-			case 0:
-				*pixelP |= rgb;
-				break;
-
-			case 1:
-				*pixelP |= rgb;
-				*(pixelP + 1) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
-				break;
-
-			default:
-				break;
-			}
+			blendStar(surfaceArea, xStart, yStart, entry._thickness, rgb);
 		}
 	}
 }
@@ -36,6 +36,7 @@ enum StarMode { MODE_STARFIELD = 0, MODE_PHOTO = 1 };
 
 class CStarCamera;
 class CStarCloseup;
+class FPose;
 class CString;
 class CSurfaceArea;
 class SimpleFile;
@@ -78,6 +79,21 @@ private:
 	void draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
+
+	/**
+	 * Transforms the positions of all the stars into camera space
+	 */
+	void projectStars(const FPose &pose);
+private:
+	/**
+	 * Star positions split per axis, so they can be transformed in bulk
+	 */
+	Common::Array<float> _posX, _posY, _posZ;
+
+	/**
+	 * Star positions in camera space, as of the last call to projectStars()
+	 */
+	Common::Array<float> _viewX, _viewY, _viewZ;
 protected:
 	FRange _minMax;
 	double _minVal;
@@ -96,6 +112,12 @@ protected:
 	 */
 	void loadData(const CString &resName);
 
+	/**
+	 * Refresh the per axis star positions after the entries were changed.
+	 * Only needed when stars are changed without changing the star count.
+	 */
+	void updatePositions();
+
 	/**
 	 * Reset the data for an entry
 	 */
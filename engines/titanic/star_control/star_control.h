@@ -108,6 +108,11 @@ public:
 	 * Updates the camerea for the star view
 	 */
 	void updateCamera() { _view.updateCamera(); }
+
+	/**
+	 * Times rendering the starfield from a set of fixed camera poses
+	 */
+	Common::Array<uint32> benchmark(uint frames) { return _view.benchmark(frames); }
 };
 
 } // End of namespace Titanic
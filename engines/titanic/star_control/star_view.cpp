@@ -31,6 +31,7 @@
 #include "titanic/core/game_object.h"
 #include "titanic/messages/pet_messages.h"
 #include "titanic/pet_control/pet_control.h"
+#include "common/system.h"
 
 namespace Titanic {
 
@@ -263,6 +264,50 @@ void CStarView::resetPosition() {
 	_camera.setPosition(FVector(0.0, 0.0, 0.0));
 }
 
+Common::Array<uint32> CStarView::benchmark(uint frames) {
+	// Camera position followed by the direction it's facing
+	static const float BENCHMARK_POSES[][6] = {
+		{ 0.0, 0.0, 0.0,  0.0, 0.0, 1.0 },
+		{ 0.0, 0.0, 0.0,  0.0, 0.0, -1.0 },
+		{ 0.0, 0.0, 0.0,  1.0, 0.0, 0.0 },
+		{ 0.0, 0.0, 0.0,  -1.0, 0.0, 0.0 },
+		{ 0.0, 0.0, 0.0,  0.0, 1.0, 0.0 },
+		{ 0.0, 0.0, 0.0,  0.0, -1.0, 0.0 },
+		{ 3.0e8, 0.0, 0.0,  -1.0, 0.0, 0.0 },
+		{ 0.0, 0.0, -3.0e8,  0.0, 0.0, 1.0 }
+	};
+	Common::Array<uint32> times;
+
+	if (!_videoSurface || !_starField || !frames)
+		return times;
+
+	CViewport viewport;
+	_camera.proc13(&viewport);
+	CStarCamera camera(&viewport);
+
+	for (uint poseNum = 0; poseNum < ARRAYSIZE(BENCHMARK_POSES); ++poseNum) {
+		const float *pose = BENCHMARK_POSES[poseNum];
+		camera.setPosition(FVector(pose[0], pose[1], pose[2]));
+		camera.setOrientation(FVector(pose[3], pose[4], pose[5]));
+
+		uint64 total = 0;
+		for (uint frameNum = 0; frameNum < frames; ++frameNum) {
+			_videoSurface->clear();
+			_videoSurface->lock();
+
+			uint64 start = g_system->getMicros();
+			_starField->render(_videoSurface, &camera);
+			total += g_system->getMicros() - start;
+
+			_videoSurface->unlock();
+		}
+
+		times.push_back((uint32)(total / frames));
+	}
+
+	return times;
+}
+
 bool CStarView::updateCamera() {
 	if (_fader.isActive() || _showingPhoto)
 		return false;
@@ -130,6 +130,12 @@ public:
 	 */
 	void resetPosition();
 
+	/**
+	 * Renders the starfield a number of times from each of a set of fixed
+	 * camera poses, and returns the average render time per pose in microseconds
+	 */
+	Common::Array<uint32> benchmark(uint frames);
+
 	void fn2();
 	void fn3(bool fadeIn);
 	void fn4();
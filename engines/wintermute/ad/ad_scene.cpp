@@ -90,6 +90,12 @@ void AdScene::setDefaults() {
 	_mainLayer = nullptr;
 
 	_pfPointsNum = 0;
+	_pfOpenValid = false;
+	_pfGridWidth = _pfGridHeight = 0;
+	_pfGridSignature = 0;
+	_pfSegmentsSignature = 0;
+	_pfStartTime = 0;
+	_pfSteps = 0;
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -175,6 +181,11 @@ void AdScene::cleanup() {
 	}
 	_pfPath.clear();
 	_pfPointsNum = 0;
+	_pfOpen.clear();
+	_pfOpenValid = false;
+	_pfGrid.clear();
+	_pfGridWidth = _pfGridHeight = 0;
+	_pfSegments.clear();
 
 	for (uint32 i = 0; i < _objects.size(); i++) {
 		_gameRef->unregisterObject(_objects[i]);
@@ -257,6 +268,11 @@ bool AdScene::getPath(const BasePoint &source, const BasePoint &target, AdPath *
 			}
 		}
 
+		_pfOpenValid = false;
+		_pfStartTime = g_system->getMillis();
+		_pfSteps = 0;
+		pfUpdateCaches();
+
 		return true;
 	}
 }
@@ -336,22 +352,8 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
 	bool ret = true;
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
-			}
-		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
-			}
-		}
+	if (checkFreeObjects && isBlockedByFreeObjects(x, y, requester)) {
+		return true;
 	}
 
 
@@ -380,26 +382,33 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 
 
 //////////////////////////////////////////////////////////////////////////
-bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = false;
-
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
+bool AdScene::isBlockedByFreeObjects(int x, int y, BaseObject *requester) {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
 	}
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
+	bool ret = false;
+
+	if (checkFreeObjects && isBlockedByFreeObjects(x, y, requester)) {
+		return false;
+	}
 
 
 	if (_mainLayer) {
@@ -430,9 +439,28 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 	x2 = p2.x;
 	y2 = p2.y;
 
+	// The walk is symmetric, so both directions share one cache entry
+	uint64 key = 0;
+	const bool cacheable = x1 >= -32768 && x1 <= 32767 && y1 >= -32768 && y1 <= 32767 &&
+	                       x2 >= -32768 && x2 <= 32767 && y2 >= -32768 && y2 <= 32767;
+	if (cacheable) {
+		if (x1 > x2 || (x1 == x2 && y1 > y2)) {
+			key = ((uint64)(uint16)x2 << 48) | ((uint64)(uint16)y2 << 32) | ((uint32)(uint16)x1 << 16) | (uint16)y1;
+		} else {
+			key = ((uint64)(uint16)x1 << 48) | ((uint64)(uint16)y1 << 32) | ((uint32)(uint16)x2 << 16) | (uint16)y2;
+		}
+
+		PfSegmentCache::const_iterator segment = _pfSegments.find(key);
+		if (segment != _pfSegments.end()) {
+			return segment->_value;
+		}
+	}
+
 	xLength = abs(x2 - x1);
 	yLength = abs(y2 - y1);
 
+	int ret = MAX(xLength, yLength);
+
 	if (xLength > yLength) {
 		if (x1 > x2) {
 			BaseUtils::swap(&x1, &x2);
@@ -443,8 +471,9 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
-				return -1;
+			if (pfIsBlockedAt(xCount, (int)y, requester)) {
+				ret = -1;
+				break;
 			}
 			y += yStep;
 		}
@@ -458,30 +487,183 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
-				return -1;
+			if (pfIsBlockedAt((int)x, yCount, requester)) {
+				ret = -1;
+				break;
 			}
 			x += xStep;
 		}
 	}
-	return MAX(xLength, yLength);
+
+	if (cacheable) {
+		_pfSegments[key] = ret;
+	}
+	return ret;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::pfIsBlockedAt(int x, int y, BaseObject *requester) {
+	if (x < 0 || y < 0 || x >= _pfGridWidth || y >= _pfGridHeight) {
+		return isBlockedAt(x, y, true, requester);
+	}
+
+	byte &cell = _pfGrid[y * _pfGridWidth + x];
+	if (cell == kPfCellUnknown) {
+		cell = isBlockedAt(x, y, false) ? kPfCellBlocked : kPfCellFree;
+	}
+
+	return cell == kPfCellBlocked || isBlockedByFreeObjects(x, y, requester);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+static void hashRegion(uint32 &hash, BaseRegion *region) {
+	// FNV-1a over everything pointInRegion() depends on
+	const int32 values[] = {
+		region->_active, region->_rect.left, region->_rect.top, region->_rect.right, region->_rect.bottom
+	};
+	for (int i = 0; i < ARRAYSIZE(values); i++) {
+		hash = (hash ^ (uint32)values[i]) * 16777619;
+	}
+	for (uint32 i = 0; i < region->_points.size(); i++) {
+		hash = (hash ^ (uint32)region->_points[i]->x) * 16777619;
+		hash = (hash ^ (uint32)region->_points[i]->y) * 16777619;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfUpdateCaches() {
+	uint32 hash = 2166136261u;
+
+	if (_mainLayer) {
+		hash = (hash ^ (uint32)_mainLayer->_width) * 16777619;
+		hash = (hash ^ (uint32)_mainLayer->_height) * 16777619;
+		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+			AdSceneNode *node = _mainLayer->_nodes[i];
+			if (node->_type == OBJECT_REGION) {
+				hash = (hash ^ (node->_region->isBlocked() ? 1 : 0) ^ (node->_region->hasDecoration() ? 2 : 0)) * 16777619;
+				hashRegion(hash, node->_region);
+			}
+		}
+	}
+
+	if (hash != _pfGridSignature || (_mainLayer && _pfGrid.empty())) {
+		_pfGridSignature = hash;
+		_pfGridWidth = _mainLayer ? MAX<int32>(_mainLayer->_width, 0) : 0;
+		_pfGridHeight = _mainLayer ? MAX<int32>(_mainLayer->_height, 0) : 0;
+		_pfGrid.clear();
+		_pfGrid.resize(_pfGridWidth * _pfGridHeight);
+		if (!_pfGrid.empty()) {
+			memset(&_pfGrid[0], kPfCellUnknown, _pfGrid.size());
+		}
+	}
+
+	hash = (hash ^ (uint32)(size_t)_pfRequester) * 16777619;
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < _objects.size() + adGame->_objects.size(); i++) {
+		AdObject *obj = i < _objects.size() ? _objects[i] : adGame->_objects[i - _objects.size()];
+		if (obj->_active && obj != _pfRequester && obj->_currentBlockRegion) {
+			hash = (hash ^ i) * 16777619;
+			hashRegion(hash, obj->_currentBlockRegion);
+		}
+	}
+
+	// Also drop the cache when it grows too large, which happens when many
+	// paths are searched without the scene changing
+	if (hash != _pfSegmentsSignature || _pfSegments.size() > 8192) {
+		_pfSegmentsSignature = hash;
+		_pfSegments.clear(true);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+static bool pfOpenIsBefore(const int32 priority1, const int32 index1, const int32 priority2, const int32 index2) {
+	return priority1 < priority2 || (priority1 == priority2 && index1 < index2);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenPush(int32 index) {
+	// Chebyshev distance is exactly what getPointsDist() returns for
+	// unblocked lines, so it never overestimates the remaining distance
+	AdPathPoint *pt = _pfPath[index];
+	PfOpenEntry entry;
+	entry.distance = pt->_distance;
+	entry.priority = pt->_distance + MAX(abs(_pfTarget->x - pt->x), abs(_pfTarget->y - pt->y));
+	entry.index = index;
+
+	uint32 pos = _pfOpen.size();
+	_pfOpen.push_back(entry);
+	while (pos > 0) {
+		uint32 parent = (pos - 1) / 2;
+		if (!pfOpenIsBefore(entry.priority, entry.index, _pfOpen[parent].priority, _pfOpen[parent].index)) {
+			break;
+		}
+		_pfOpen[pos] = _pfOpen[parent];
+		pos = parent;
+	}
+	_pfOpen[pos] = entry;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfRebuildOpen() {
+	_pfOpen.clear();
+	for (int32 i = 0; i < _pfPointsNum; i++) {
+		if (!_pfPath[i]->_marked && _pfPath[i]->_distance != INT_MAX) {
+			pfOpenPush(i);
+		}
+	}
+	_pfOpenValid = true;
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
 	int i;
-	// get lowest unmarked
-	int lowestDist = INT_MAX;
+	if (!_pfOpenValid) {
+		pfRebuildOpen();
+	}
+	_pfSteps++;
+
+	// get lowest unmarked, skipping entries superseded by a shorter distance
 	AdPathPoint *lowestPt = nullptr;
+	while (!_pfOpen.empty() && lowestPt == nullptr) {
+		const PfOpenEntry top = _pfOpen[0];
+		const PfOpenEntry last = _pfOpen.back();
+		_pfOpen.pop_back();
+
+		uint32 pos = 0;
+		const uint32 size = _pfOpen.size();
+		while (size > 0) {
+			uint32 child = pos * 2 + 1;
+			if (child >= size) {
+				break;
+			}
+			if (child + 1 < size && pfOpenIsBefore(_pfOpen[child + 1].priority, _pfOpen[child + 1].index, _pfOpen[child].priority, _pfOpen[child].index)) {
+				child++;
+			}
+			if (!pfOpenIsBefore(_pfOpen[child].priority, _pfOpen[child].index, last.priority, last.index)) {
+				break;
+			}
+			_pfOpen[pos] = _pfOpen[child];
+			pos = child;
+		}
+		if (size > 0) {
+			_pfOpen[pos] = last;
+		}
 
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
+		AdPathPoint *pt = _pfPath[top.index];
+		if (!pt->_marked && pt->_distance == top.distance) {
+			lowestPt = pt;
 		}
+	}
 
 	if (lowestPt == nullptr) { // no path -> terminate PathFinder
+		debugC(kWintermuteDebugGeneral, "AdScene::PathFinderStep - No path found (%d steps, %d ms)", _pfSteps, g_system->getMillis() - _pfStartTime);
 		_pfReady = true;
 		_pfTargetPath->setReady(true);
 		return;
@@ -496,6 +678,7 @@ void AdScene::pathFinderStep() {
 			lowestPt = lowestPt->_origin;
 		}
 
+		debugC(kWintermuteDebugGeneral, "AdScene::PathFinderStep - Path found (%d steps, %d ms)", _pfSteps, g_system->getMillis() - _pfStartTime);
 		_pfReady = true;
 		_pfTargetPath->setReady(true);
 		return;
@@ -504,10 +687,17 @@ void AdScene::pathFinderStep() {
 	// otherwise keep on searching
 	for (i = 0; i < _pfPointsNum; i++)
 		if (!_pfPath[i]->_marked) {
-			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
+			// Only walk the line if it could make the way shorter
+			int j = MAX(abs(_pfPath[i]->x - lowestPt->x), abs(_pfPath[i]->y - lowestPt->y));
+			if (lowestPt->_distance + j >= _pfPath[i]->_distance) {
+				continue;
+			}
+
+			j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
 			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
 				_pfPath[i]->_distance = lowestPt->_distance + j;
 				_pfPath[i]->_origin = lowestPt;
+				pfOpenPush(i);
 			}
 		}
 }
@@ -526,6 +716,10 @@ bool AdScene::initLoop() {
 		_gameRef->LOG(0, "STAT: PathFinder iterations in one loop: %d (%s)  _pfMaxTime=%d", nu_steps, _pfReady ? "finished" : "not yet done", _pfMaxTime);
 	}
 #else
+	if (!_pfReady) {
+		pfUpdateCaches();
+	}
+
 	uint32 start = _gameRef->_currentTime;
 	while (!_pfReady && g_system->getMillis() - start <= _pfMaxTime) {
 		pathFinderStep();
@@ -2348,6 +2542,11 @@ bool AdScene::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferPtr(TMEMBER_PTR(_pfRequester));
 	persistMgr->transferPtr(TMEMBER_PTR(_pfTarget));
 	persistMgr->transferPtr(TMEMBER_PTR(_pfTargetPath));
+	if (!persistMgr->getIsSaving()) {
+		_pfOpenValid = false;
+		_pfGrid.clear();
+		_pfSegments.clear();
+	}
 	_rotLevels.persist(persistMgr);
 	_scaleLevels.persist(persistMgr);
 	persistMgr->transferSint32(TMEMBER(_scrollPixelsH));
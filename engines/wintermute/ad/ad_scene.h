@@ -31,6 +31,9 @@
 
 #include "engines/wintermute/base/base_fader.h"
 
+#include "common/array.h"
+#include "common/hashmap.h"
+
 namespace Wintermute {
 
 class UIWindow;
@@ -153,6 +156,7 @@ public:
 	BaseArray<AdRotLevel *> _rotLevels;
 
 	virtual bool restoreDeviceObjects();
+	// Only valid while a path is searched, as it uses the path finder caches
 	int getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester = nullptr);
 
 	// scripting interface
@@ -165,12 +169,51 @@ public:
 private:
 	bool persistState(bool saving = true);
 	void pfAddWaypointGroup(AdWaypointGroup *Wpt, BaseObject *requester = nullptr);
+	bool isBlockedByFreeObjects(int x, int y, BaseObject *requester);
 	bool _pfReady;
 	BasePoint *_pfTarget;
 	AdPath *_pfTargetPath;
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	// A* open list, a binary heap of the reached but not yet marked points.
+	// It is not saved, but rebuilt from _pfPath when needed.
+	struct PfOpenEntry {
+		int32 priority; // distance plus the estimate of the remaining distance
+		int32 distance;
+		int32 index;
+	};
+	Common::Array<PfOpenEntry> _pfOpen;
+	bool _pfOpenValid;
+	void pfOpenPush(int32 index);
+	void pfRebuildOpen();
+
+	// Walkability of the scene regions, resolved per pixel on first use and
+	// reset whenever the regions change. Free objects are checked separately.
+	enum {
+		kPfCellUnknown = 0,
+		kPfCellFree,
+		kPfCellBlocked
+	};
+	Common::Array<byte> _pfGrid;
+	int32 _pfGridWidth;
+	int32 _pfGridHeight;
+	uint32 _pfGridSignature;
+	bool pfIsBlockedAt(int x, int y, BaseObject *requester);
+
+	// Results of getPointsDist(), kept as long as neither the regions nor the
+	// free objects blocking the way change
+	struct PfSegmentHash {
+		uint operator()(uint64 key) const { return (uint)(key ^ (key >> 32)); }
+	};
+	typedef Common::HashMap<uint64, int32, PfSegmentHash> PfSegmentCache;
+	PfSegmentCache _pfSegments;
+	uint32 _pfSegmentsSignature;
+	void pfUpdateCaches();
+
+	uint32 _pfStartTime;
+	uint32 _pfSteps;
+
 	int32 _offsetTop;
 	int32 _offsetLeft;
 
@@ -29,23 +29,20 @@
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/base_package.h"
 #include "common/stream.h"
-#include "common/substream.h"
 #include "common/zlib.h"
 
 namespace Wintermute {
 
 Common::SeekableReadStream *BaseFileEntry::createReadStream() const {
-	Common::SeekableReadStream *file = _package->getFilePointer();
+	bool compressed = (_compressedLength != 0);
+
+	Common::SeekableReadStream *file = _package->createRangeStream(_offset, compressed ? _compressedLength : _length);
 	if (!file) {
 		return nullptr;
 	}
 
-	bool compressed = (_compressedLength != 0);
-
 	if (compressed) {
-		file = Common::wrapCompressedReadStream(new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES), _length); //
-	} else {
-		file = new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES);
+		file = Common::wrapCompressedReadStream(file, _length);
 	}
 
 	file->seek(0);
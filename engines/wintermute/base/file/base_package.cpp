@@ -31,11 +31,85 @@
 #include "engines/wintermute/base/file/dcpackage.h"
 #include "engines/wintermute/wintermute.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/debug.h"
 
 namespace Wintermute {
 
+/** Entries up to this size are read into memory when they are opened. */
+static const uint32 kPackageMemoryEntrySize = 64 * 1024;
+
+/**
+ * Stream over a byte range of a shared package file. Every read repositions
+ * the package file, so any number of these can be open at the same time.
+ */
+class BasePackageRangeStream : public Common::SeekableReadStream {
+public:
+	BasePackageRangeStream(const Common::SharedPtr<BasePackageFile> &file, uint32 begin, uint32 end) :
+		_file(file), _begin(begin), _end(end), _pos(begin), _eos(false), _err(false) {}
+
+	virtual bool eos() const { return _eos; }
+	virtual bool err() const { return _err; }
+	virtual void clearErr() { _eos = _err = false; }
+
+	virtual int32 pos() const { return _pos - _begin; }
+	virtual int32 size() const { return _end - _begin; }
+
+	virtual bool seek(int32 offset, int whence = SEEK_SET) {
+		int64 newPos;
+		switch (whence) {
+		case SEEK_END:
+			newPos = (int64)_end + offset;
+			break;
+		case SEEK_CUR:
+			newPos = (int64)_pos + offset;
+			break;
+		case SEEK_SET:
+		default:
+			newPos = (int64)_begin + offset;
+			break;
+		}
+		if (newPos < _begin || newPos > _end) {
+			return false;
+		}
+		_pos = (uint32)newPos;
+		_eos = false;
+		return true;
+	}
+
+	virtual uint32 read(void *dataPtr, uint32 dataSize) {
+		if (dataSize > _end - _pos) {
+			dataSize = _end - _pos;
+			_eos = true;
+		}
+		if (dataSize == 0) {
+			return 0;
+		}
+
+		Common::StackLock lock(_file->_mutex);
+		Common::SeekableReadStream *stream = _file->_stream;
+		uint32 bytesRead = 0;
+		if (stream->seek(_pos, SEEK_SET)) {
+			bytesRead = stream->read(dataPtr, dataSize);
+		}
+		if (bytesRead != dataSize) {
+			_err = true;
+			stream->clearErr();
+		}
+		_pos += bytesRead;
+		return bytesRead;
+	}
+
+private:
+	Common::SharedPtr<BasePackageFile> _file;
+	uint32 _begin;
+	uint32 _end;
+	uint32 _pos;
+	bool _eos;
+	bool _err;
+};
+
 BasePackage::BasePackage() {
 	_name = "";
 	_cd = 0;
@@ -43,10 +117,34 @@ BasePackage::BasePackage() {
 	_boundToExe = false;
 }
 
-Common::SeekableReadStream *BasePackage::getFilePointer() {
-	Common::SeekableReadStream *stream = _fsnode.createReadStream();
+Common::SeekableReadStream *BasePackage::createRangeStream(uint32 offset, uint32 size) {
+	// Keep the package open instead of opening it again for every entry
+	if (!_file) {
+		Common::SeekableReadStream *stream = _fsnode.createReadStream();
+		if (!stream) {
+			return nullptr;
+		}
+		_file = Common::SharedPtr<BasePackageFile>(new BasePackageFile(stream));
+	}
 
-	return stream;
+	if (size > kPackageMemoryEntrySize) {
+		return new BasePackageRangeStream(_file, offset, offset + size);
+	}
+
+	byte *data = (byte *)malloc(size ? size : 1);
+	if (!data) {
+		return nullptr;
+	}
+
+	Common::StackLock lock(_file->_mutex);
+	Common::SeekableReadStream *stream = _file->_stream;
+	if (!stream->seek(offset, SEEK_SET) || stream->read(data, size) != size) {
+		debugC(kWintermuteDebugFileAccess, "Could not read %d bytes at %d from package '%s'", size, offset, _name.c_str());
+		stream->clearErr();
+		free(data);
+		return nullptr;
+	}
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
 }
 
 static bool findPackageSignature(Common::SeekableReadStream *f, uint32 *offset) {
@@ -236,16 +334,13 @@ PackageSet::~PackageSet() {
 }
 
 bool PackageSet::hasFile(const Common::String &name) const {
-	Common::String upcName = name;
-	upcName.toUppercase();
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::const_iterator it;
-	it = _files.find(upcName.c_str());
+	FileMap::const_iterator it = _files.find(name);
 	return (it != _files.end());
 }
 
 int PackageSet::listMembers(Common::ArchiveMemberList &list) const {
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::const_iterator it = _files.begin();
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::const_iterator end = _files.end();
+	FileMap::const_iterator it = _files.begin();
+	FileMap::const_iterator end = _files.end();
 	int count = 0;
 	for (; it != end; ++it) {
 		const Common::ArchiveMemberPtr ptr(it->_value);
@@ -256,18 +351,12 @@ int PackageSet::listMembers(Common::ArchiveMemberList &list) const {
 }
 
 const Common::ArchiveMemberPtr PackageSet::getMember(const Common::String &name) const {
-	Common::String upcName = name;
-	upcName.toUppercase();
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::const_iterator it;
-	it = _files.find(upcName.c_str());
+	FileMap::const_iterator it = _files.find(name);
 	return Common::ArchiveMemberPtr(it->_value);
 }
 
 Common::SeekableReadStream *PackageSet::createReadStreamForMember(const Common::String &name) const {
-	Common::String upcName = name;
-	upcName.toUppercase();
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::const_iterator it;
-	it = _files.find(upcName.c_str());
+	FileMap::const_iterator it = _files.find(name);
 	if (it != _files.end()) {
 		return it->_value->createReadStream();
 	}
@@ -32,17 +32,40 @@
 #include "common/archive.h"
 #include "common/stream.h"
 #include "common/fs.h"
+#include "common/mutex.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
+
+/**
+ * A package file opened once and shared by the streams of all its entries.
+ * Entries can be read from the mixer thread too, so every access to the
+ * underlying stream has to hold the mutex.
+ */
+struct BasePackageFile {
+	Common::SeekableReadStream *_stream;
+	Common::Mutex _mutex;
+
+	BasePackageFile(Common::SeekableReadStream *stream) : _stream(stream) {}
+	~BasePackageFile() { delete _stream; }
+};
+
 class BasePackage {
 public:
-	Common::SeekableReadStream *getFilePointer();
+	/**
+	 * Create a stream for the given byte range of the package file.
+	 * Small ranges are read into memory right away, larger ones are read on
+	 * demand from the shared package file.
+	 */
+	Common::SeekableReadStream *createRangeStream(uint32 offset, uint32 size);
 	Common::FSNode _fsnode;
 	bool _boundToExe;
 	byte _priority;
 	Common::String _name;
 	int32 _cd;
 	BasePackage();
+private:
+	Common::SharedPtr<BasePackageFile> _file;
 };
 
 class PackageSet : public Common::Archive {
@@ -81,8 +104,9 @@ public:
 private:
 	byte _priority;
 	Common::Array<BasePackage *> _packages;
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr> _files;
-	Common::HashMap<Common::String, Common::ArchiveMemberPtr>::iterator _filesIter;
+	typedef Common::HashMap<Common::String, Common::ArchiveMemberPtr, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> FileMap;
+	FileMap _files;
+	FileMap::iterator _filesIter;
 };
 
 } // End of namespace Wintermute
@@ -156,7 +156,7 @@ public:
 	BaseObject *getObjectAt(int x, int y);
 	void deleteRectList();
 
-	virtual bool startSpriteBatch() {
+	virtual bool startSpriteBatch(bool reuseTickets = true) {
 		return STATUS_OK;
 	};
 	virtual bool endSpriteBatch() {
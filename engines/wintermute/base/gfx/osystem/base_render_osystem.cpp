@@ -54,6 +54,7 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_lastFrameIter = _renderQueue.end();
 	_needsFlip = true;
 	_skipThisFrame = false;
+	_skipTicketReuse = false;
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
@@ -283,7 +284,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		return;
 	}
 
-	if (owner) { // Fade-tickets are owner-less
+	if (owner && !_skipTicketReuse) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
 		RenderQueueIterator it = _lastFrameIter;
 		++it;
@@ -581,11 +582,13 @@ void BaseRenderOSystem::endSaveLoad() {
 	g_system->updateScreen();
 }
 
-bool BaseRenderOSystem::startSpriteBatch() {
+bool BaseRenderOSystem::startSpriteBatch(bool reuseTickets) {
+	_skipTicketReuse = !reuseTickets;
 	return STATUS_OK;
 }
 
 bool BaseRenderOSystem::endSpriteBatch() {
+	_skipTicketReuse = false;
 	return STATUS_OK;
 }
 
@@ -107,7 +107,7 @@ public:
 	float getScaleRatioY() const override {
 		return _ratioY;
 	}
-	virtual bool startSpriteBatch() override;
+	virtual bool startSpriteBatch(bool reuseTickets = true) override;
 	virtual bool endSpriteBatch() override;
 	void endSaveLoad();
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
@@ -147,6 +147,10 @@ private:
 
 	bool _skipThisFrame;
 	int _lastScreenChangeID; // previous value of OSystem::getScreenChangeID()
+
+	// Set for sprite batches that move every frame (particles), whose sprites
+	// are not matched against the tickets of the previous frame
+	bool _skipTicketReuse;
 };
 
 } // End of namespace Wintermute
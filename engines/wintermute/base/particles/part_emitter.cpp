@@ -282,9 +282,12 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 			}
 
 			int toGen = MIN(_genAmount, _maxParticles - numLive);
+			// Particles before the last reused one are all alive, so the
+			// search for a dead one continues from there
+			uint32 searchStart = 0;
 			while (toGen > 0) {
 				int firstDeadIndex = -1;
-				for (uint32 i = 0; i < _particles.size(); i++) {
+				for (uint32 i = searchStart; i < _particles.size(); i++) {
 					if (_particles[i]->_isDead) {
 						firstDeadIndex = i;
 						break;
@@ -294,6 +297,7 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 				PartParticle *particle;
 				if (firstDeadIndex >= 0) {
 					particle = _particles[firstDeadIndex];
+					searchStart = firstDeadIndex;
 				} else {
 					particle = new PartParticle(_gameRef);
 					_particles.add(particle);
@@ -321,9 +325,8 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::display(BaseRegion *region) {
-	if (_sprites.size() <= 1) {
-		BaseEngine::getRenderer()->startSpriteBatch();
-	}
+	// Particles move every frame, so don't look for tickets to reuse
+	BaseEngine::getRenderer()->startSpriteBatch(false);
 
 	for (uint32 i = 0; i < _particles.size(); i++) {
 		if (region != nullptr && _useRegion) {
@@ -335,9 +338,7 @@ bool PartEmitter::display(BaseRegion *region) {
 		_particles[i]->display(this);
 	}
 
-	if (_sprites.size() <= 1) {
-		BaseEngine::getRenderer()->endSpriteBatch();
-	}
+	BaseEngine::getRenderer()->endSpriteBatch();
 
 	return STATUS_OK;
 }
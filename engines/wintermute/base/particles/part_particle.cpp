@@ -94,6 +94,11 @@ bool PartParticle::setSprite(const Common::String &filename) {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartParticle::update(PartEmitter *emitter, uint32 currentTime, uint32 timerDelta) {
+	// Dead particles are completely reinitialized before they are used again
+	if (_isDead) {
+		return STATUS_OK;
+	}
+
 	if (_state == PARTICLE_FADEIN) {
 		if (currentTime - _fadeStart >= (uint32)_fadeTime) {
 			_state = PARTICLE_NORMAL;
@@ -35,6 +35,9 @@
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/persistent.h"
 
+#include "common/array.h"
+#include "common/str.h"
+
 namespace Wintermute {
 class BaseScriptHolder;
 class BaseObject;
@@ -80,6 +83,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getVar(const Common::String &name);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -153,6 +157,9 @@ public:
 private:
 	char **_symbols;
 	uint32 _numSymbols;
+	// The symbols converted once, so that looking up variables does not
+	// have to create a string every time
+	Common::Array<Common::String> _symbolNames;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
 	TEventPos *_events;
@@ -178,12 +178,16 @@ ScValue *ScValue::getProp(const char *name) {
 
 	ScValue *ret = nullptr;
 
+	// Natives and the property map look the name up as a string, so only
+	// convert it once
+	const Common::String propName(name);
+
 	if (_type == VAL_NATIVE && _valNative) {
-		ret = _valNative->scGetProperty(name);
+		ret = _valNative->scGetProperty(propName);
 	}
 
 	if (ret == nullptr) {
-		_valIter = _valObject.find(name);
+		_valIter = _valObject.find(propName);
 		if (_valIter != _valObject.end()) {
 			ret = _valIter->_value;
 		}
@@ -191,6 +195,19 @@ ScValue *ScValue::getProp(const char *name) {
 	return ret;
 }
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const Common::String &name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		return _valIter->_value;
+	}
+	return nullptr;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::deleteProp(const char *name) {
 	if (_type == VAL_VARIABLE_REF) {
@@ -222,8 +239,11 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 	if (DID_FAIL(ret)) {
 		ScValue *newVal = nullptr;
 
+		// Look the property up only once, existing properties are updated
+		// through the iterator
 		_valIter = _valObject.find(name);
-		if (_valIter != _valObject.end()) {
+		const bool exists = (_valIter != _valObject.end());
+		if (exists) {
 			newVal = _valIter->_value;
 		}
 		if (!newVal) {
@@ -234,7 +254,11 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
+		if (exists) {
+			_valIter->_value = newVal;
+		} else {
+			_valObject[name] = newVal;
+		}
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -83,6 +83,11 @@ public:
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	/**
+	 * Returns the value stored for a property of the object, without asking
+	 * the native object, or nullptr if there is none.
+	 */
+	ScValue *findProp(const Common::String &name);
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
@@ -32,10 +32,17 @@ namespace ZVision {
 RenderTable::RenderTable(uint numColumns, uint numRows)
 	: _numRows(numRows),
 	  _numColumns(numColumns),
-	  _renderState(FLAT) {
+	  _renderState(FLAT),
+	  _bilinearFiltering(false) {
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_warpTable = new WarpEntry[numRows * numColumns];
+
+	for (uint y = 0; y < numRows; ++y) {
+		for (uint x = 0; x < numColumns; ++x)
+			setTableEntry(x, y, x, y);
+	}
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -43,6 +50,7 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _warpTable;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -83,47 +91,79 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 	return newPoint;
 }
 
-void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
+// The warped surfaces are RGB555. Spreading the green channel into the upper
+// half leaves enough room between the channels to scale all of them with a
+// single multiplication.
+static inline uint32 spreadRGB555(uint16 color) {
+	return (color & 0x7C1F) | ((uint32)(color & 0x03E0) << 16);
+}
 
-	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+static inline uint16 packRGB555(uint32 color) {
+	return (uint16)((color & 0x7C1F) | ((color >> 16) & 0x03E0));
+}
 
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+static inline uint32 lerpRGB555(uint32 a, uint32 b, uint weight) {
+	return ((a * (32 - weight) + b * weight) >> 5) & 0x03E07C1F;
+}
+
+void RenderTable::mutateRowBilinear(const uint16 *sourceBuffer, uint16 *destBuffer, const WarpEntry *entry, uint count) {
+	for (uint x = 0; x < count; ++x, ++entry) {
+		const uint16 *source = sourceBuffer + entry->sourceIndex;
+
+		uint32 top = lerpRGB555(spreadRGB555(source[0]), spreadRGB555(source[entry->stepX]), entry->fracX);
+		uint32 bottom = lerpRGB555(spreadRGB555(source[entry->stepY]), spreadRGB555(source[entry->stepY + entry->stepX]), entry->fracX);
+
+		destBuffer[x] = packRGB555(lerpRGB555(top, bottom, entry->fracY));
+	}
+}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
+	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
+		const WarpEntry *entry = &_warpTable[y * _numColumns + subRect.left];
 
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
+		if (_bilinearFiltering) {
+			mutateRowBilinear(sourceBuffer, destBuffer, entry, subRect.width());
+		} else {
+			for (int16 x = 0; x < subRect.width(); ++x)
+				destBuffer[x] = sourceBuffer[entry[x].sourceIndex];
 		}
 
-		destOffset += destWidth;
+		destBuffer += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
-
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
-	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const WarpEntry *entry = &_warpTable[y * _numColumns];
+		uint16 *destBuffer = (uint16 *)dstBuf->getBasePtr(0, y);
+
+		if (_bilinearFiltering) {
+			mutateRowBilinear(sourceBuffer, destBuffer, entry, srcBuf->w);
+		} else {
+			for (int16 x = 0; x < srcBuf->w; ++x)
+				destBuffer[x] = sourceBuffer[entry[x].sourceIndex];
+		}
+	}
+}
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+void RenderTable::setTableEntry(uint x, uint y, float sourceX, float sourceY) {
+	int32 xInCylinderCoords = int32(floor(sourceX));
+	int32 yInCylinderCoords = int32(floor(sourceY));
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+	uint32 index = y * _numColumns + x;
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
-		}
-	}
+	// Only store the (x,y) offsets instead of the absolute positions
+	_internalBuffer[index].x = xInCylinderCoords - x;
+	_internalBuffer[index].y = yInCylinderCoords - y;
+
+	WarpEntry &entry = _warpTable[index];
+	entry.sourceIndex = yInCylinderCoords * _numColumns + xInCylinderCoords;
+	entry.stepX = (xInCylinderCoords + 1 < (int32)_numColumns) ? 1 : 0;
+	entry.stepY = (yInCylinderCoords + 1 < (int32)_numRows) ? _numColumns : 0;
+	entry.fracX = entry.stepX ? (uint8)((sourceX - xInCylinderCoords) * 32.0f) : 0;
+	entry.fracY = entry.stepY ? (uint8)((sourceY - yInCylinderCoords) * 32.0f) : 0;
 }
 
 void RenderTable::generateRenderTable() {
@@ -141,8 +181,6 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
-
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -156,20 +194,16 @@ void RenderTable::generatePanoramaLookupTable() {
 
 		// To get x in cylinder coordinates, we just need to calculate the arc length
 		// We also scale it by _panoramaOptions.linearScale
-		int32 xInCylinderCoords = int32(floor((cylinderRadius * _panoramaOptions.linearScale * alpha) + halfWidth));
+		float xInCylinderCoords = (cylinderRadius * _panoramaOptions.linearScale * alpha) + halfWidth;
 
 		float cosAlpha = cos(alpha);
 
 		for (uint y = 0; y < _numRows; ++y) {
 			// To calculate y in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
-			int32 yInCylinderCoords = int32(floor(halfHeight + ((float)y - halfHeight) * cosAlpha));
-
-			uint32 index = y * _numColumns + x;
+			float yInCylinderCoords = halfHeight + ((float)y - halfHeight) * cosAlpha;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setTableEntry(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -190,21 +224,16 @@ void RenderTable::generateTiltLookupTable() {
 
 		// To get y in cylinder coordinates, we just need to calculate the arc length
 		// We also scale it by _tiltOptions.linearScale
-		int32 yInCylinderCoords = int32(floor((cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight));
+		float yInCylinderCoords = (cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight;
 
 		float cosAlpha = cos(alpha);
-		uint32 columnIndex = y * _numColumns;
 
 		for (uint x = 0; x < _numColumns; ++x) {
 			// To calculate x in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
-			int32 xInCylinderCoords = int32(floor(halfWidth + ((float)x - halfWidth) * cosAlpha));
-
-			uint32 index = columnIndex + x;
+			float xInCylinderCoords = halfWidth + ((float)x - halfWidth) * cosAlpha;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setTableEntry(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -41,9 +41,23 @@ public:
 	};
 
 private:
+	/**
+	 * Precomputed source position of a warped pixel. The fraction is in
+	 * 1/32 pixel units, which is all the 5 bit color channels need.
+	 */
+	struct WarpEntry {
+		uint32 sourceIndex; ///< Offset of the (top left) source pixel
+		uint16 stepY;       ///< Offset to the pixel below, 0 on the last row
+		uint8 stepX;        ///< Offset to the pixel to the right, 0 on the last column
+		uint8 fracX;
+		uint8 fracY;
+	};
+
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	WarpEntry *_warpTable;
 	RenderState _renderState;
+	bool _bilinearFiltering;
 
 	struct {
 		float fieldOfView;
@@ -66,6 +80,10 @@ public:
 	}
 	void setRenderState(RenderState newState);
 
+	/** Smooth the warped image instead of picking the nearest source pixel */
+	void setBilinearFiltering(bool enable) { _bilinearFiltering = enable; }
+	bool getBilinearFiltering() const { return _bilinearFiltering; }
+
 	const Common::Point convertWarpedCoordToFlatCoord(const Common::Point &point);
 
 	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
@@ -90,6 +108,8 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void setTableEntry(uint x, uint y, float sourceX, float sourceY);
+	void mutateRowBilinear(const uint16 *sourceBuffer, uint16 *destBuffer, const WarpEntry *entry, uint count);
 };
 
 } // End of namespace ZVision
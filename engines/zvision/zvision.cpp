@@ -237,6 +237,9 @@ void ZVision::initialize() {
 	_console = new Console(this);
 	_doubleFPS = ConfMan.getBool("doublefps");
 
+	if (ConfMan.hasKey("smoothpanorama"))
+		_renderManager->getRenderTable()->setBilinearFiltering(ConfMan.getBool("smoothpanorama"));
+
 	// Initialize FPS timer callback
 	getTimerManager()->installTimerProc(&fpsTimerCallback, 1000000, this, "zvisionFPS");
 }
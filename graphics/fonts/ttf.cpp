@@ -36,6 +36,7 @@
 #include "common/singleton.h"
 #include "common/stream.h"
 #include "common/memstream.h"
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/ptr.h"
 #include "common/unzip.h"
@@ -136,7 +137,7 @@ private:
 	int _ascent, _descent;
 
 	struct Glyph {
-		Surface image;
+		Surface image;	///< View into one of the atlas pages
 		int xOffset, yOffset;
 		int advance;
 		FT_UInt slot;
@@ -146,7 +147,31 @@ private:
 	typedef Common::HashMap<uint32, Glyph> GlyphCache;
 	mutable GlyphCache _glyphs;
 	bool _allowLateCaching;
-	void assureCached(uint32 chr) const;
+	const Glyph *findGlyph(uint32 chr) const;
+
+	/**
+	 * Direct lookup of the glyphs loaded for the first 256 characters, which
+	 * covers almost all text drawn. The glyph cache never moves its values,
+	 * so pointers into it stay valid.
+	 */
+	const Glyph *_glyphTable[256];
+
+	/**
+	 * The glyph images are packed into shelves on a few larger surfaces,
+	 * instead of every glyph owning a surface of its own.
+	 */
+	enum {
+		kAtlasPageSize = 256
+	};
+
+	mutable Common::Array<Surface *> _atlasPages;
+	mutable Surface *_atlasPage;	///< Page new glyphs are added to
+	mutable int _atlasX, _atlasY, _atlasShelfHeight;
+	void allocateGlyphImage(Surface &image, int w, int h) const;
+
+	/** Kerning offsets of character pairs already looked up. */
+	typedef Common::HashMap<uint32, int> KerningCache;
+	mutable KerningCache _kerning;
 
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
@@ -162,7 +187,8 @@ private:
 TTFFont::TTFFont()
     : _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
       _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
-      _hasKerning(false), _allowLateCaching(false) {
+      _hasKerning(false), _allowLateCaching(false), _atlasPage(nullptr), _atlasX(0), _atlasY(0), _atlasShelfHeight(0) {
+	memset(_glyphTable, 0, sizeof(_glyphTable));
 }
 
 TTFFont::~TTFFont() {
@@ -172,8 +198,12 @@ TTFFont::~TTFFont() {
 		delete[] _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
+		for (uint i = 0; i < _atlasPages.size(); ++i) {
+			_atlasPages[i]->free();
+			delete _atlasPages[i];
+		}
+		_atlasPages.clear();
+		_atlasPage = nullptr;
 
 		_initialized = false;
 	}
@@ -275,6 +305,12 @@ bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode siz
 		}
 	}
 
+	for (uint i = 0; i < 256; ++i) {
+		GlyphCache::const_iterator glyphEntry = _glyphs.find(i);
+		if (glyphEntry != _glyphs.end())
+			_glyphTable[i] = &glyphEntry->_value;
+	}
+
 	_initialized = (_glyphs.size() != 0);
 	return _initialized;
 }
@@ -408,55 +444,51 @@ int TTFFont::getMaxCharWidth() const {
 }
 
 int TTFFont::getCharWidth(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph)
 		return 0;
 	else
-		return glyphEntry->_value.advance;
+		return glyph->advance;
 }
 
 int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
-	assureCached(left);
-	assureCached(right);
-
-	FT_UInt leftGlyph, rightGlyph;
-	GlyphCache::const_iterator glyphEntry;
-
-	glyphEntry = _glyphs.find(left);
-	if (glyphEntry != _glyphs.end()) {
-		leftGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
+	// Pairs of characters from the basic multilingual plane fit into a single
+	// key, all others are rare enough to be looked up every time.
+	const bool cacheable = (left <= 0xFFFF && right <= 0xFFFF);
+	const uint32 key = (left << 16) | right;
+	if (cacheable) {
+		KerningCache::const_iterator kerningEntry = _kerning.find(key);
+		if (kerningEntry != _kerning.end())
+			return kerningEntry->_value;
 	}
 
-	glyphEntry = _glyphs.find(right);
-	if (glyphEntry != _glyphs.end()) {
-		rightGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
+	const Glyph *leftGlyph = findGlyph(left);
+	const Glyph *rightGlyph = findGlyph(right);
+
+	int offset = 0;
+	if (leftGlyph && rightGlyph && leftGlyph->slot && rightGlyph->slot) {
+		FT_Vector kerningVector;
+		FT_Get_Kerning(_face, leftGlyph->slot, rightGlyph->slot, FT_KERNING_DEFAULT, &kerningVector);
+		offset = kerningVector.x / 64;
 	}
 
-	if (!leftGlyph || !rightGlyph)
-		return 0;
+	if (cacheable)
+		_kerning[key] = offset;
 
-	FT_Vector kerningVector;
-	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	return offset;
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end()) {
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph) {
 		return Common::Rect();
 	} else {
-		const int xOffset = glyphEntry->_value.xOffset;
-		const int yOffset = glyphEntry->_value.yOffset;
-		const Graphics::Surface &image = glyphEntry->_value.image;
+		const int xOffset = glyph->xOffset;
+		const int yOffset = glyph->yOffset;
+		const Graphics::Surface &image = glyph->image;
 		return Common::Rect(xOffset, yOffset, xOffset + image.w, yOffset + image.h);
 	}
 }
@@ -500,12 +532,11 @@ void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos, const i
 } // End of anonymous namespace
 
 void TTFFont::drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyphPtr = findGlyph(chr);
+	if (!glyphPtr)
 		return;
 
-	const Glyph &glyph = glyphEntry->_value;
+	const Glyph &glyph = *glyphPtr;
 
 	x += glyph.xOffset;
 	y += glyph.yOffset;
@@ -597,7 +628,7 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	glyph.advance = ftCeil26_6(_face->glyph->advance.x);
 
 	const FT_Bitmap &bitmap = _face->glyph->bitmap;
-	glyph.image.create(bitmap.width, bitmap.rows, PixelFormat::createFormatCLUT8());
+	allocateGlyphImage(glyph.image, bitmap.width, bitmap.rows);
 
 	const uint8 *src = bitmap.buffer;
 	int srcPitch = bitmap.pitch;
@@ -606,8 +637,8 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		srcPitch = -srcPitch;
 	}
 
+	// Atlas pages are cleared on creation, so only set pixels need writing
 	uint8 *dst = (uint8 *)glyph.image.getPixels();
-	memset(dst, 0, glyph.image.h * glyph.image.pitch);
 
 	switch (bitmap.pixel_mode) {
 	case FT_PIXEL_MODE_MONO:
@@ -620,12 +651,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					dst[x] = 255;
 
 				mask <<= 1;
-				++dst;
 			}
 
+			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
 		break;
@@ -640,22 +671,73 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 
 	default:
 		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
-		glyph.image.free();
+		// The atlas space stays unused, the page is freed with the font
+		glyph.image = Surface();
 		return false;
 	}
 
 	return true;
 }
 
-void TTFFont::assureCached(uint32 chr) const {
-	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
+void TTFFont::allocateGlyphImage(Surface &image, int w, int h) const {
+	if (!w || !h) {
+		image.init(w, h, 0, nullptr, PixelFormat::createFormatCLUT8());
 		return;
 	}
 
-	Glyph newGlyph;
-	if (cacheGlyph(newGlyph, chr)) {
-		_glyphs[chr] = newGlyph;
+	Surface *page;
+	int x, y;
+
+	if (w > kAtlasPageSize || h > kAtlasPageSize) {
+		// Glyphs too big for a shared page get one of their own
+		page = new Surface();
+		page->create(w, h, PixelFormat::createFormatCLUT8());
+		_atlasPages.push_back(page);
+		x = y = 0;
+	} else {
+		if (_atlasX + w > kAtlasPageSize) {
+			// Start a new shelf
+			_atlasX = 0;
+			_atlasY += _atlasShelfHeight;
+			_atlasShelfHeight = 0;
+		}
+
+		if (!_atlasPage || _atlasY + h > kAtlasPageSize) {
+			_atlasPage = new Surface();
+			_atlasPage->create(kAtlasPageSize, kAtlasPageSize, PixelFormat::createFormatCLUT8());
+			_atlasPages.push_back(_atlasPage);
+			_atlasX = _atlasY = _atlasShelfHeight = 0;
+		}
+
+		page = _atlasPage;
+		x = _atlasX;
+		y = _atlasY;
+		_atlasX += w;
+		_atlasShelfHeight = MAX(_atlasShelfHeight, h);
 	}
+
+	image = page->getSubArea(Common::Rect(x, y, x + w, y + h));
+}
+
+const TTFFont::Glyph *TTFFont::findGlyph(uint32 chr) const {
+	// Everything below 256 was tried when loading the font
+	if (chr < ARRAYSIZE(_glyphTable))
+		return _glyphTable[chr];
+
+	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
+	if (glyphEntry != _glyphs.end())
+		return &glyphEntry->_value;
+
+	if (!_allowLateCaching)
+		return nullptr;
+
+	Glyph newGlyph;
+	if (!cacheGlyph(newGlyph, chr))
+		return nullptr;
+
+	Glyph &glyph = _glyphs[chr];
+	glyph = newGlyph;
+	return &glyph;
 }
 
 Font *loadTTFFont(Common::SeekableReadStream &stream, int size, TTFSizeMode sizeMode, uint dpi, TTFRenderMode renderMode, const uint32 *mapping) {
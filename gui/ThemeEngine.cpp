@@ -91,6 +91,12 @@ struct WidgetDrawData {
 
 	DrawLayer _layer;
 
+	/**
+	 * Set when every draw step sets all the renderer colors it uses, so
+	 * that the result does not depend on what was drawn before it.
+	 */
+	bool _cacheable;
+
 
 	/**
 	 * Calculates the background threshold offset of a given DrawData item.
@@ -172,7 +178,7 @@ static const DrawDataInfo kDrawDataDefaults[] = {
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
-	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
+	_font(0), _widgetCacheSize(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(0) {
 
 	_system = g_system;
@@ -216,6 +222,8 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 }
 
 ThemeEngine::~ThemeEngine() {
+	clearWidgetCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = 0;
 	_screen.free();
@@ -351,6 +359,7 @@ void ThemeEngine::clearAll() {
 	if (_initOk) {
 		_system->clearOverlay();
 		_system->grabOverlay(_backBuffer.getPixels(), _backBuffer.pitch);
+		clearWidgetCache();
 	}
 }
 
@@ -443,6 +452,8 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
 
+	clearWidgetCache();
+
 	// Since we reinitialized our screen surfaces we know nothing has been
 	// drawn so far. Sometimes we still end up with dirty screen bits in the
 	// list. Clearing it avoids invalid overlay writes when the backend
@@ -463,6 +474,16 @@ void WidgetDrawData::calcBackgroundOffset() {
 
 	_backgroundOffset = maxBevel;
 	_shadowOffset = maxShadow;
+
+	_cacheable = true;
+	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
+	        step != _steps.end(); ++step) {
+		if (!step->fgColor.set ||
+		        (step->fillMode == Graphics::VectorRenderer::kFillBackground && !step->bgColor.set) ||
+		        (step->fillMode == Graphics::VectorRenderer::kFillGradient && !(step->gradColor1.set && step->gradColor2.set)) ||
+		        (step->bevel && !step->bevelColor.set))
+			_cacheable = false;
+	}
 }
 
 void ThemeEngine::restoreBackground(Common::Rect r) {
@@ -721,6 +742,8 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearWidgetCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -863,7 +886,31 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		extendedRect.clip(_clip);
 	}
 
-	if (forceRestore || drawData->_layer == kDrawLayerBackground)
+	bool restore = forceRestore || drawData->_layer == kDrawLayerBackground;
+
+	// Widgets drawn onto a restored background can be taken from the cache
+	WidgetCacheKey cacheKey;
+	Common::Rect cacheRect = extendedRect;
+	cacheRect.clip(_screen.w, _screen.h);
+	bool cacheable = restore && drawData->_cacheable && drawData->_layer == _layerToDraw &&
+	                 _vectorRenderer->getActiveSurface() == &_screen && !cacheRect.isEmpty();
+
+	if (cacheable) {
+		cacheKey.type = type;
+		cacheKey.dynamic = dynamic;
+		cacheKey.area = area;
+		cacheKey.clip = _clip;
+
+		WidgetCache::const_iterator cached = _widgetCache.find(cacheKey);
+		if (cached != _widgetCache.end()) {
+			const Graphics::Surface *surf = cached->_value;
+			_screen.copyRectToSurface(*surf, cacheRect.left, cacheRect.top, Common::Rect(surf->w, surf->h));
+			addDirtyRect(extendedRect);
+			return;
+		}
+	}
+
+	if (restore)
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
@@ -874,6 +921,31 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 
 		addDirtyRect(extendedRect);
 	}
+
+	if (cacheable) {
+		uint32 size = cacheRect.width() * cacheRect.height() * _screen.format.bytesPerPixel;
+
+		// Keep the cache within a few screens worth of pixels
+		if (_widgetCacheSize + size > 4U * _screen.pitch * _screen.h)
+			clearWidgetCache();
+
+		Graphics::Surface *surf = new Graphics::Surface();
+		surf->create(cacheRect.width(), cacheRect.height(), _screen.format);
+		surf->copyRectToSurface(_screen, 0, 0, cacheRect);
+
+		_widgetCache[cacheKey] = surf;
+		_widgetCacheSize += size;
+	}
+}
+
+void ThemeEngine::clearWidgetCache() {
+	for (WidgetCache::iterator i = _widgetCache.begin(); i != _widgetCache.end(); ++i) {
+		i->_value->free();
+		delete i->_value;
+	}
+
+	_widgetCache.clear();
+	_widgetCacheSize = 0;
 }
 
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text,
@@ -1305,20 +1377,34 @@ void ThemeEngine::addDirtyRect(Common::Rect r) {
 	if (r.isEmpty())
 		return;
 
-	// Check if the new rectangle is contained within another in the list
-	Common::List<Common::Rect>::iterator it;
-	for (it = _dirtyScreen.begin(); it != _dirtyScreen.end();) {
+	// Every separate rectangle costs an extra copy to the overlay, count
+	// that as this many pixels when deciding whether to merge rectangles.
+	const int kDirtyRectCost = 64 * 64;
+
+	uint i = 0;
+	while (i < _dirtyScreen.size()) {
+		const Common::Rect &dirty = _dirtyScreen[i];
+
 		// If we find a rectangle which fully contains the new one,
-		// we can abort the search.
-		if (it->contains(r))
+		// we are done.
+		if (dirty.contains(r))
 			return;
 
-		// Conversely, if we find rectangles which are contained in
-		// the new one, we can remove them
-		if (r.contains(*it))
-			it = _dirtyScreen.erase(it);
-		else
-			++it;
+		Common::Rect merged = dirty;
+		merged.extend(r);
+
+		// Merge rectangles contained in the new one, as well as those
+		// which are cheaper to copy along with it than on their own.
+		// As the new rectangle grows, the ones already checked need
+		// to be checked again.
+		if (r.contains(dirty) ||
+		        merged.width() * merged.height() <= dirty.width() * dirty.height() + r.width() * r.height() + kDirtyRectCost) {
+			r = merged;
+			_dirtyScreen.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
 	}
 
 	// If we got here, we can safely add r to the list of dirty rects.
@@ -1329,9 +1415,8 @@ void ThemeEngine::updateDirtyScreen() {
 	if (_dirtyScreen.empty())
 		return;
 
-	Common::List<Common::Rect>::iterator i;
-	for (i = _dirtyScreen.begin(); i != _dirtyScreen.end(); ++i) {
-		_vectorRenderer->copyFrame(_system, *i);
+	for (uint i = 0; i < _dirtyScreen.size(); ++i) {
+		_vectorRenderer->copyFrame(_system, _dirtyScreen[i]);
 	}
 
 	_dirtyScreen.clear();
@@ -1885,6 +1970,8 @@ void ThemeEngine::hideCursor() {
 }
 
 void ThemeEngine::drawToBackbuffer() {
+	// Widgets are cached along with the background they were drawn on
+	clearWidgetCache();
 	_vectorRenderer->setSurface(&_backBuffer);
 }
 
@@ -27,6 +27,7 @@
 #include "common/fs.h"
 #include "common/hash-str.h"
 #include "common/hashmap.h"
+#include "common/array.h"
 #include "common/list.h"
 #include "common/str.h"
 #include "common/rect.h"
@@ -437,8 +438,9 @@ public:
 
 	/**
 	 * Actual implementation of a dirty rect handling.
-	 * Dirty rectangles are queued on a list, merged and optimized
-	 * when possible and are later used for the actual drawing.
+	 * Dirty rectangles are queued on a list and merged with the queued
+	 * rectangles whenever copying their union to the overlay is cheaper
+	 * than copying them separately. They are later used for the actual drawing.
 	 *
 	 * @param r Area of the dirty rect.
 	 */
@@ -624,6 +626,12 @@ protected:
 	 */
 	void updateDirtyScreen();
 
+	/**
+	 * Drops all cached widget renderings. Must be called whenever the
+	 * back buffer or the theme changes.
+	 */
+	void clearWidgetCache();
+
 	/**
 	 * Draws a GUI element according to a DrawData descriptor.
 	 *
@@ -720,7 +728,39 @@ protected:
 #endif
 
 	/** List of all the dirty screens that must be blitted to the overlay. */
-	Common::List<Common::Rect> _dirtyScreen;
+	Common::Array<Common::Rect> _dirtyScreen;
+
+	/**
+	 * Identifies a DrawData item drawn on top of a freshly restored
+	 * background. As long as the back buffer is unchanged, drawing the
+	 * same item at the same place always yields the same pixels.
+	 */
+	struct WidgetCacheKey {
+		DrawData type;
+		uint32 dynamic;
+		Common::Rect area;
+		Common::Rect clip;
+
+		bool operator==(const WidgetCacheKey &other) const {
+			return type == other.type && dynamic == other.dynamic && area == other.area && clip == other.clip;
+		}
+	};
+
+	struct WidgetCacheKey_Hash {
+		uint operator()(const WidgetCacheKey &key) const {
+			uint hash = key.type * 31 + key.dynamic;
+			hash = hash * 31 + (key.area.left | (key.area.top << 16));
+			hash = hash * 31 + (key.area.right | (key.area.bottom << 16));
+			hash = hash * 31 + (key.clip.left | (key.clip.top << 16));
+			return hash * 31 + (key.clip.right | (key.clip.bottom << 16));
+		}
+	};
+
+	typedef Common::HashMap<WidgetCacheKey, Graphics::Surface *, WidgetCacheKey_Hash> WidgetCache;
+
+	/** Screen contents of recently drawn widgets, see WidgetCacheKey. */
+	WidgetCache _widgetCache;
+	uint32 _widgetCacheSize; ///< Total size of the cached surfaces, in bytes
 
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
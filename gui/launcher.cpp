@@ -22,6 +22,7 @@
 
 #include "base/version.h"
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/events.h"
 #include "common/fs.h"
@@ -245,7 +246,29 @@ void LauncherDialog::close() {
 	Dialog::close();
 }
 
+namespace {
+
+struct LauncherEntry {
+	Common::String key;
+	Common::String description;
+	ThemeEngine::FontColor color;
+
+	LauncherEntry(const Common::String &k, const Common::String &d, ThemeEngine::FontColor c) : key(k), description(d), color(c) {}
+};
+
+struct LauncherEntryComparator {
+	bool operator()(const LauncherEntry &x, const LauncherEntry &y) const {
+		int result = scumm_stricmp(x.description.c_str(), y.description.c_str());
+		if (result == 0)
+			return x.key < y.key;
+		return result < 0;
+	}
+};
+
+} // End of anonymous namespace
+
 void LauncherDialog::updateListing() {
+	Common::Array<LauncherEntry> entries;
 	StringArray l;
 	ListWidget::ColorList colors;
 	ThemeEngine::FontColor color;
@@ -280,12 +303,6 @@ void LauncherDialog::updateListing() {
 		}
 
 		if (!gameid.empty() && !description.empty()) {
-			// Insert the game into the launcher list
-			int pos = 0, size = l.size();
-
-			while (pos < size && (scumm_stricmp(description.c_str(), l[pos].c_str()) > 0))
-				pos++;
-
 			color = ThemeEngine::kFontColorNormal;
 			if (!path.isDirectory()) {
 				color = ThemeEngine::kFontColorAlternate;
@@ -296,12 +313,23 @@ void LauncherDialog::updateListing() {
 				// description += Common::String::format(" (%s)", _("Not found"));
 			}
 
-			l.insert_at(pos, description);
-			colors.insert_at(pos, color);
-			_domains.insert_at(pos, iter->_key);
+			entries.push_back(LauncherEntry(iter->_key, description, color));
 		}
 	}
 
+	// Sort the games by description once all of them are known, rather than
+	// inserting every game at its place in the sorted list
+	Common::sort(entries.begin(), entries.end(), LauncherEntryComparator());
+
+	l.reserve(entries.size());
+	colors.reserve(entries.size());
+	_domains.reserve(entries.size());
+	for (Common::Array<LauncherEntry>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+		l.push_back(i->description);
+		colors.push_back(i->color);
+		_domains.push_back(i->key);
+	}
+
 	const int oldSel = _list->getSelected();
 	_list->setList(l, &colors);
 	if (oldSel < (int)l.size())
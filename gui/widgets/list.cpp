@@ -159,6 +159,7 @@ void ListWidget::setList(const StringArray &list, const ColorList *colors) {
 
 	// Copy everything
 	_dataList = list;
+	_dataListLowercase.clear();
 	_list = list;
 	_filter.clear();
 	_listIndex.clear();
@@ -193,6 +194,12 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 		_listColors.push_back(color);
 	}
 
+	if (_dataListLowercase.size() == _dataList.size()) {
+		String lowercase = s;
+		lowercase.toLowercase();
+		_dataListLowercase.push_back(lowercase);
+	}
+
 	_dataList.push_back(s);
 	_list.push_back(s);
 
@@ -675,6 +682,11 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	if (_filter == filt) // Filter was not changed
 		return;
 
+	// When characters were only added to the filter, every entry matching
+	// the new filter also matched the old one, so only the entries which
+	// are currently shown need to be checked again.
+	const bool narrow = !_filter.empty() && filt.hasPrefix(_filter) && _listIndex.size() == _list.size();
+
 	_filter = filt;
 
 	if (_filter.empty()) {
@@ -685,28 +697,42 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 		// Restrict the list to everything which contains all words in _filter
 		// as substrings, ignoring case.
 
+		StringArray words;
 		Common::StringTokenizer tok(_filter);
-		String tmp;
-		int n = 0;
+		while (!tok.empty())
+			words.push_back(tok.nextToken());
+
+		if (_dataListLowercase.size() != _dataList.size()) {
+			_dataListLowercase = _dataList;
+			for (StringArray::iterator i = _dataListLowercase.begin(); i != _dataListLowercase.end(); ++i)
+				i->toLowercase();
+		}
+
+		Common::Array<int> candidates;
+		if (narrow) {
+			candidates = _listIndex;
+		} else {
+			candidates.resize(_dataList.size());
+			for (uint i = 0; i < _dataList.size(); ++i)
+				candidates[i] = i;
+		}
 
 		_list.clear();
 		_listIndex.clear();
 
-		for (StringArray::iterator i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = *i;
-			tmp.toLowercase();
+		for (Common::Array<int>::const_iterator n = candidates.begin(); n != candidates.end(); ++n) {
+			const String &entry = _dataListLowercase[*n];
 			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
+			for (StringArray::const_iterator word = words.begin(); word != words.end(); ++word) {
+				if (!entry.contains(*word)) {
 					matches = false;
 					break;
 				}
 			}
 
 			if (matches) {
-				_list.push_back(*i);
-				_listIndex.push_back(n);
+				_list.push_back(_dataList[*n]);
+				_listIndex.push_back(*n);
 			}
 		}
 	}
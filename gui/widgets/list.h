@@ -55,6 +55,7 @@ public:
 protected:
 	StringArray		_list;
 	StringArray		_dataList;
+	StringArray		_dataListLowercase;	///< lowercase copy of _dataList for filtering, built on demand
 	ColorList		_listColors;
 	Common::Array<int>		_listIndex;
 	bool			_editable;